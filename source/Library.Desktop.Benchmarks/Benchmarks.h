@@ -0,0 +1,33 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+
+namespace LibraryDesktopBenchmarks
+{
+	/// <summary>
+	/// Returns how long given function takes to run, in the requested duration units.
+	/// </summary>
+	template <typename TDuration, typename TFunction>
+	long long Time(TFunction function)
+	{
+		auto start = std::chrono::steady_clock::now();
+		function();
+		auto end = std::chrono::steady_clock::now();
+		return std::chrono::duration_cast<TDuration>(end - start).count();
+	}
+
+	/// <summary>
+	/// Constructs 1M GameObjects and 1M ActionIncrements (100k each in Debug) and prints the time each takes.
+	/// </summary>
+	void ConstructionBenchmark();
+
+	/// <summary>
+	/// Times Hashmap against FlatHashmap building and searching the Scope shapes of the test suite, and prints both.
+	/// </summary>
+	void HashmapBenchmark();
+
+	/// <summary>
+	/// Times insert/remove churn through chains with pooled nodes against heap nodes, and through a Hashmap, and prints all three.
+	/// </summary>
+	void ChurnBenchmark();
+}
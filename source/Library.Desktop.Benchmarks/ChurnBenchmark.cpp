@@ -0,0 +1,92 @@
+#include "pch.h"
+#include "Benchmarks.h"
+#include "Hashmap.h"
+#include "HashFunctor.h"
+#include "SList.h"
+#include "Vector.h"
+#include <memory>
+
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace LibraryDesktopBenchmarks
+{
+	namespace
+	{
+		using churn_chain = SList<std::pair<const int, int>>;
+
+		/// <summary>
+		/// Churns a steady population through chains laid out like Hashmap buckets. A nullptr pool
+		/// allocates every node from the heap, as SList did before node pools.
+		/// </summary>
+		long long TimeChainChurn(std::shared_ptr<churn_chain::NodePool> pool, int population, int rounds)
+		{
+			HashFunctor<int> hash;
+			const std::size_t bucketCount = static_cast<std::size_t>(population);
+			Vector<churn_chain> chains(bucketCount);
+			for (std::size_t i = 0; i < bucketCount; ++i)
+			{
+				chains.PushBack(churn_chain(pool));
+			}
+
+			return Time<std::chrono::microseconds>([&chains, &hash, bucketCount, population, rounds]
+			{
+				for (int r = 0; r < rounds; ++r)
+				{
+					for (int i = 0; i < population; ++i)
+					{
+						chains[hash(i) % bucketCount].PushBack(std::make_pair(i, r));
+					}
+					for (int i = 0; i < population; ++i)
+					{
+						churn_chain& chain = chains[hash(i) % bucketCount];
+						for (auto it = chain.begin(); it != chain.end(); ++it)
+						{
+							if ((*it).first == i)
+							{
+								chain.Remove(it);
+								break;
+							}
+						}
+					}
+				}
+			});
+		}
+
+		/// <summary>
+		/// Churns the same population through a Hashmap, which recycles its chain nodes through its own pool.
+		/// </summary>
+		long long TimeHashmapChurn(int population, int rounds)
+		{
+			Hashmap<int, int> map(static_cast<std::size_t>(population));
+			return Time<std::chrono::microseconds>([&map, population, rounds]
+			{
+				for (int r = 0; r < rounds; ++r)
+				{
+					for (int i = 0; i < population; ++i)
+					{
+						map.Insert(std::make_pair(i, r));
+					}
+					for (int i = 0; i < population; ++i)
+					{
+						map.Remove(i);
+					}
+				}
+			});
+		}
+	}
+
+	void ChurnBenchmark()
+	{
+		// Insert/remove churn on a steady population, as a scope with transient attributes sees.
+		// The chain runs share one layout and differ only in where chain nodes come from.
+		const int population = 256;
+		const int rounds = 2000;
+
+		auto pooled = TimeChainChurn(std::make_shared<churn_chain::NodePool>(), population, rounds);
+		auto heap = TimeChainChurn(nullptr, population, rounds);
+		auto map = TimeHashmapChurn(population, rounds);
+
+		cout << "Insert/remove churn  pooled nodes: " << pooled << "us  heap nodes: " << heap << "us  Hashmap: " << map << "us" << endl;
+	}
+}
@@ -0,0 +1,48 @@
+#include "pch.h"
+#include "Benchmarks.h"
+#include "GameObject.h"
+#include "ActionIncrement.h"
+#include "Vector.h"
+
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace LibraryDesktopBenchmarks
+{
+	namespace
+	{
+		/// <summary>
+		/// Constructs given number of objects at once, touches each, then destroys them all.
+		/// </summary>
+		template <typename T>
+		long long TimeConstruction(std::size_t count)
+		{
+			return Time<std::chrono::milliseconds>([count]
+			{
+				Vector<T> objects(count);
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					objects.EmplaceBack();
+				}
+				if (!objects.Back().IsPrescribedAttribute("Name"s))
+				{
+					throw std::runtime_error("Constructed object is missing its prescribed attributes.");
+				}
+			});
+		}
+	}
+
+	void ConstructionBenchmark()
+	{
+#if defined(_DEBUG)
+		const std::size_t count = 100000;
+#else
+		const std::size_t count = 1000000;
+#endif
+		auto gameObjects = TimeConstruction<GameObject>(count);
+		auto actions = TimeConstruction<ActionIncrement>(count);
+
+		cout << count << " GameObjects: " << gameObjects << "ms  "
+			<< count << " ActionIncrements: " << actions << "ms" << endl;
+	}
+}
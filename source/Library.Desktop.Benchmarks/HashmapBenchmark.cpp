@@ -0,0 +1,64 @@
+#include "pch.h"
+#include "Benchmarks.h"
+#include "Hashmap.h"
+#include "FlatHashmap.h"
+#include "Datum.h"
+#include "Vector.h"
+
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace LibraryDesktopBenchmarks
+{
+	namespace
+	{
+		/// <summary>
+		/// Builds a map of given keys, as a Scope does when it is populated, then looks each key up ten times.
+		/// </summary>
+		template <typename TMap>
+		long long TimeScopeShape(const Vector<std::string>& keys, int repetitions)
+		{
+			return Time<std::chrono::microseconds>([&keys, repetitions]
+			{
+				for (int r = 0; r < repetitions; ++r)
+				{
+					TMap map;
+					for (const auto& key : keys)
+					{
+						map.Insert(std::make_pair(key, Datum()));
+					}
+					for (int pass = 0; pass < 10; ++pass)
+					{
+						for (const auto& key : keys)
+						{
+							if (!map.ContainsKey(key))
+							{
+								throw std::runtime_error("Inserted key not found.");
+							}
+						}
+					}
+				}
+			});
+		}
+	}
+
+	void HashmapBenchmark()
+	{
+		// Scope shapes from the test suite: the prescribed GameObject layout plus a wide level scope.
+		Vector<std::string> smallKeys{ "this", "Name", "Position", "Rotation", "Scale", "Children", "Actions" };
+		Vector<std::string> wideKeys;
+		for (int i = 0; i < 500; ++i)
+		{
+			wideKeys.PushBack("Attribute" + std::to_string(i));
+		}
+
+		const int repetitions = 2000;
+		auto chainedSmall = TimeScopeShape<Hashmap<std::string, Datum>>(smallKeys, repetitions);
+		auto flatSmall = TimeScopeShape<FlatHashmap<std::string, Datum>>(smallKeys, repetitions);
+		auto chainedWide = TimeScopeShape<Hashmap<std::string, Datum>>(wideKeys, repetitions / 10);
+		auto flatWide = TimeScopeShape<FlatHashmap<std::string, Datum>>(wideKeys, repetitions / 10);
+
+		cout << "Small scope  Hashmap: " << chainedSmall << "us  FlatHashmap: " << flatSmall << "us" << endl
+			<< "Wide scope   Hashmap: " << chainedWide << "us  FlatHashmap: " << flatWide << "us" << endl;
+	}
+}
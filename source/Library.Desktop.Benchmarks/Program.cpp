@@ -0,0 +1,48 @@
+#include "pch.h"
+#include "Benchmarks.h"
+#include "TypeRegistry.h"
+#include "GameObject.h"
+#include "ActionIncrement.h"
+
+using namespace FieaGameEngine;
+using namespace LibraryDesktopBenchmarks;
+using namespace std;
+
+namespace
+{
+	struct Benchmark final
+	{
+		const char* _name;
+		void (*_run)();
+	};
+
+	const Benchmark Benchmarks[]
+	{
+		{ "Construction", ConstructionBenchmark },
+		{ "Hashmap", HashmapBenchmark },
+		{ "Churn", ChurnBenchmark }
+	};
+}
+
+/// <summary>
+/// Runs every benchmark, or only those whose name contains the first argument, and prints their timings.
+/// Build and run in Release for meaningful numbers.
+/// </summary>
+int main(int argc, char* argv[])
+{
+	TypeRegistry& registry = TypeRegistry::GetInstance();
+	registry.RegisterSignaturesOfType<GameObject>();
+	registry.RegisterSignaturesOfType<Action>();
+	registry.RegisterSignaturesOfType<ActionIncrement>();
+
+	const std::string filter = argc > 1 ? argv[1] : ""s;
+	for (const Benchmark& benchmark : Benchmarks)
+	{
+		if (std::string(benchmark._name).find(filter) != std::string::npos)
+		{
+			cout << benchmark._name << endl;
+			benchmark._run();
+		}
+	}
+	return 0;
+}
@@ -17,6 +17,22 @@ using namespace std;
 
 namespace LibraryDesktopTests
 {
+	/// <summary>
+	/// Records how many actions another object holds each time this object is updated.
+	/// </summary>
+	class ObservingGameObject final : public GameObject
+	{
+	public:
+		void UpdateSelf(const GameTime& time) override
+		{
+			GameObject::UpdateSelf(time);
+			ObservedActionCount = Observed->Actions().Size();
+		}
+
+		GameObject* Observed{ nullptr };
+		std::size_t ObservedActionCount{ 0 };
+	};
+
 	TEST_CLASS(ActionTests)
 	{
 	public:
@@ -109,6 +125,89 @@ namespace LibraryDesktopTests
 			Assert::AreEqual(3.0f, datum.GetFloat());
 		}
 
+		TEST_METHOD(ActionIncrementCachedTarget)
+		{
+			ActionList list;
+			Scope& child = list.AppendScope("Child"s);
+			child["B"s] = 0.0f;
+			auto increment = static_cast<ActionIncrement*>(list.CreateAction(ActionIncrement::TypeName(), "Increment"s));
+			increment->SetTarget("B"s);
+
+			GameTime time;
+			increment->Update(time);
+			Assert::AreEqual(1.0f, child["B"s].GetFloat());
+
+			// Reusing a name changes nothing, a new name may shadow the cached target.
+			std::size_t generation = Scope::StructureGeneration();
+			child["B"s] = 5.0f;
+			Assert::AreEqual(generation, Scope::StructureGeneration());
+			child["C"s] = 0.0f;
+			Assert::AreNotEqual(generation, Scope::StructureGeneration());
+
+			// Clearing the target's Scope must not leave a dangling cache behind.
+			child.Clear();
+			child["B"s] = 10.0f;
+			increment->Update(time);
+			Assert::AreEqual(11.0f, child["B"s].GetFloat());
+
+			// Writing the prescribed attribute directly retargets as well as SetTarget does.
+			list["A"s] = 0.0f;
+			(*increment)["Target"s].SetString("A"s);
+			increment->Update(time);
+			Assert::AreEqual(1.0f, list["A"s].GetFloat());
+			Assert::AreEqual(11.0f, child["B"s].GetFloat());
+		}
+
+		TEST_METHOD(ActionIncrementUpdateRun)
+		{
+			const std::size_t runLength = 150;
+			const std::size_t targetCount = 13;
+			ActionList batched;
+			ActionList reference;
+			for (ActionList* list : { &batched, &reference })
+			{
+				for (std::size_t i = 0; i < targetCount; ++i)
+				{
+					(*list)["T"s + std::to_string(i)] = 0.1f;
+				}
+				for (std::size_t i = 0; i < runLength; ++i)
+				{
+					auto increment = static_cast<ActionIncrement*>(list->CreateAction(ActionIncrement::TypeName(), "Increment"s));
+					increment->SetTarget(i % 11 == 0 ? ""s : "T"s + std::to_string(i % 4 == 0 ? 0 : i % targetCount));
+					(*increment)["Step"s].SetFloat(0.1f * float(i % 7));
+				}
+				list->CreateAction(ActionList::TypeName(), "Break"s);
+				static_cast<ActionIncrement*>(list->CreateAction(ActionIncrement::TypeName(), "Increment"s))->SetTarget("T0"s);
+			}
+
+			// The run stops at the first action that is not an increment.
+			GameTime time;
+			Datum& actions = *batched.Find("Actions"s);
+			Assert::AreEqual(runLength, ActionIncrement::UpdateRun(actions, 0, time));
+			Assert::AreEqual(runLength + 2, ActionIncrement::UpdateRun(actions, runLength + 1, time));
+			Assert::AreEqual(runLength + 2, ActionIncrement::UpdateRun(actions, runLength + 2, time));
+
+			// Grouping by target adds each target's steps in the same order as updating one at a time,
+			// even with more targets than UpdateRun holds open at once.
+			for (int frame = 0; frame < 2; ++frame)
+			{
+				for (std::size_t i = 0; i < runLength + 2; ++i)
+				{
+					reference.GetAction(i).Update(time);
+				}
+				for (std::size_t i = 0; i < targetCount; ++i)
+				{
+					const std::string name = "T"s + std::to_string(i);
+					Assert::AreEqual(reference[name].GetFloat(), batched[name].GetFloat());
+				}
+				batched.Update(time);
+			}
+
+			// A target holding no value fails just as Update does.
+			batched["T0"s].Clear();
+			Assert::ExpectException<std::runtime_error>([&batched, &time] { batched.Update(time); });
+		}
+
 		TEST_METHOD(ActionCreateActionUpdate)
 		{
 			ActionList list;
@@ -166,6 +265,101 @@ namespace LibraryDesktopTests
 			Assert::IsNotNull(destroyAction);
 		}
 
+		TEST_METHOD(DeferredStructuralChanges)
+		{
+			GameObject gameObject;
+			Datum& counter = gameObject.AppendAuxiliaryAttribute("Counter"s);
+			counter = 0.0f;
+
+			auto list = static_cast<ActionList*>(gameObject.CreateAction(ActionList::TypeName(), "List"s));
+			static_cast<ActionIncrement*>(list->CreateAction(ActionIncrement::TypeName(), "First"s))->SetTarget("Counter"s);
+			auto destroy = static_cast<ActionDestroyAction*>(list->CreateAction(ActionDestroyAction::TypeName(), "Destroy"s));
+			destroy->SetClassName(ActionIncrement::TypeName());
+			destroy->SetInstanceName("First"s);
+			auto create = static_cast<ActionCreateAction*>(list->CreateAction(ActionCreateAction::TypeName(), "Create"s));
+			create->SetClassName(ActionIncrement::TypeName());
+			create->SetInstanceName("Created"s);
+			static_cast<ActionIncrement*>(list->CreateAction(ActionIncrement::TypeName(), "Last"s))->SetTarget("Counter"s);
+			Assert::IsTrue(destroy->GetGameObject() == &gameObject);
+			Assert::IsTrue(list->IsSubtreeLocal(gameObject));
+
+			// Removing First while the list iterates would have shifted Last out from under it.
+			GameTime time;
+			gameObject.Update(time);
+			Assert::AreEqual(2.0f, counter.GetFloat());
+			Assert::AreEqual(std::size_t(4), list->Actions().Size());
+			Assert::AreEqual("Destroy"s, list->GetAction(0).Name());
+			Assert::AreEqual("Created"s, list->GetAction(3).Name());
+
+			// A copy does not inherit the queue of the original.
+			create->Update(time);
+			GameObject copy(gameObject);
+			const std::size_t copiedCount = static_cast<ActionList&>(copy.GetAction()).Actions().Size();
+			copy.ApplyActionQueue();
+			Assert::AreEqual(copiedCount, static_cast<ActionList&>(copy.GetAction()).Actions().Size());
+			gameObject.ApplyActionQueue();
+			Assert::AreEqual(std::size_t(5), list->Actions().Size());
+
+			// A list and one of its own actions destroyed in the same batch are each deleted once.
+			gameObject.PushOnDestroyQueue(list->GetAction(0));
+			gameObject.PushOnDestroyQueue(*list);
+			gameObject.PushOnDestroyQueue(*list);
+			gameObject.ApplyActionQueue();
+			Assert::AreEqual(std::size_t(0), gameObject.Actions().Size());
+
+			// Actions still waiting in the queue are freed with their GameObject.
+			gameObject.PushOnActionQueue(static_cast<Action*>(Factory<RTTI>::Create(ActionIncrement::TypeName())));
+			Assert::ExpectException<std::runtime_error>([&gameObject] { gameObject.PushOnActionQueue(nullptr); });
+		}
+
+		TEST_METHOD(DeferredUntilEndOfRecursiveUpdate)
+		{
+			ObservingGameObject root;
+			auto* child = new GameObject();
+			root.Adopt(*child, "Children"s);
+			root.Observed = child;
+			auto create = static_cast<ActionCreateAction*>(child->CreateAction(ActionCreateAction::TypeName(), "Create"s));
+			create->SetClassName(ActionIncrement::TypeName());
+			create->SetInstanceName("Created"s);
+
+			// The parent updates after the child in the same frame, so it must not see the creation yet.
+			GameTime time;
+			root.Update(time);
+			Assert::AreEqual(std::size_t(1), root.ObservedActionCount);
+			Assert::AreEqual(std::size_t(2), child->Actions().Size());
+			root.Update(time);
+			Assert::AreEqual(std::size_t(2), root.ObservedActionCount);
+			Assert::AreEqual(std::size_t(3), child->Actions().Size());
+		}
+
+		TEST_METHOD(TypeHierarchy)
+		{
+			ActionListWhile loop;
+			const RTTI& rtti = loop;
+			Assert::IsTrue(rtti.Is<ActionListWhile>());
+			Assert::IsTrue(rtti.Is<ActionList>());
+			Assert::IsTrue(rtti.Is<Scope>());
+			Assert::IsFalse(rtti.Is<ActionIncrement>());
+			Assert::IsFalse(rtti.Is<GameObject>());
+			Assert::IsFalse(rtti.Is(RTTI::TypeIdClass()));
+			Assert::IsTrue(rtti.Is(Attributed::TypeIdClass()));
+			Assert::IsFalse(rtti.Is(GameObject::TypeIdClass()));
+			Assert::IsTrue(rtti.Is(Action::TypeName()));
+			Assert::IsFalse(rtti.Is(ActionIncrement::TypeName()));
+			Assert::IsFalse(rtti.Is("Missing"s));
+			Assert::IsTrue(rtti.As<Action>() == &loop);
+			Assert::IsNull(rtti.As<ActionCreateAction>());
+			Assert::IsTrue(loop.QueryInterface(Scope::TypeIdClass()) == &loop);
+			Assert::IsNull(loop.QueryInterface(GameObject::TypeIdClass()));
+
+			const RTTI::TypeInfo& type = ActionListWhile::TypeInfoClass();
+			Assert::IsTrue(&type == &rtti.TypeInfoInstance());
+			Assert::AreEqual(ActionListWhile::TypeIdClass(), type.Id());
+			Assert::AreEqual(Scope::TypeInfoClass().Depth() + 4, type.Depth());
+			Assert::IsTrue(RTTI::TypeInfo::Find("ActionListWhile") == &type);
+			Assert::IsNull(RTTI::TypeInfo::Find("Missing"));
+		}
+
 		TEST_METHOD(ActionParse)
 		{
 			GameObject scope;
@@ -196,17 +390,17 @@ namespace LibraryDesktopTests
 			Assert::AreEqual(Datum::DatumType::Vector, scope.Find("Position")->Type());
 			glm::vec4 a(1, 2, 3, 4);
 			Assert::AreEqual(a, scope.Find("Position")->FrontVector());
-			Assert::AreEqual(a, scope.Position);
+			Assert::AreEqual(a, scope.Position());
 
 			Assert::AreEqual(Datum::DatumType::Vector, scope.Find("Rotation")->Type());
 			glm::vec4 b(2, 2, 3, 4);
 			Assert::AreEqual(b, scope.Find("Rotation")->FrontVector());
-			Assert::AreEqual(b, scope.Rotation);
+			Assert::AreEqual(b, scope.Rotation());
 
 			Assert::AreEqual(Datum::DatumType::Vector, scope.Find("Scale")->Type());
 			glm::vec4 c(3, 2, 3, 4);
 			Assert::AreEqual(c, scope.Find("Scale")->FrontVector());
-			Assert::AreEqual(c, scope.Scale);
+			Assert::AreEqual(c, scope.Scale());
 
 			Assert::AreEqual(Datum::DatumType::Table, scope.Find("Children")->Type());
 			Assert::AreEqual(std::size_t(2), scope.Find("Children")->Size());
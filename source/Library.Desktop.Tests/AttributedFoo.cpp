@@ -10,23 +10,24 @@ namespace FieaGameEngine
 	{
 	}
 
-	const Vector<Signature> AttributedFoo::Signatures()
+	gsl::span<const Signature> AttributedFoo::Signatures()
 	{
-		return Vector<Signature>
+		static constexpr Signature signatures[]
 		{
-			{ "ExternalInteger", Datum::DatumType::Integer, 1, offsetof(AttributedFoo, ExternalInteger) },
-			{ "ExternalFloat", Datum::DatumType::Float, 1, offsetof(AttributedFoo, ExternalFloat) },
-			{ "ExternalString", Datum::DatumType::String, 1, offsetof(AttributedFoo, ExternalString) },
-			{ "ExternalVector", Datum::DatumType::Vector, 1, offsetof(AttributedFoo, ExternalVector) },
-			{ "ExternalMatrix", Datum::DatumType::Matrix, 1, offsetof(AttributedFoo, ExternalMatrix) },
-			{ "ExternalIntegerArray", Datum::DatumType::Integer, ArraySize, offsetof(AttributedFoo, ExternalIntegerArray) },
-			{ "ExternalFloatArray", Datum::DatumType::Float, ArraySize, offsetof(AttributedFoo, ExternalFloatArray) },
-			{ "ExternalStringArray", Datum::DatumType::String, ArraySize, offsetof(AttributedFoo, ExternalStringArray) },
-			{ "ExternalVectorArray", Datum::DatumType::Vector, ArraySize, offsetof(AttributedFoo, ExternalVectorArray) },
-			{ "ExternalMatrixArray", Datum::DatumType::Matrix, ArraySize, offsetof(AttributedFoo, ExternalMatrixArray) },
-			{ "NestedScope", Datum::DatumType::Table, 0, 0 },
-			{ "NestedScopeArray", Datum::DatumType::Table, ArraySize, 0 }
+			SIGNATURE_OF(AttributedFoo, ExternalInteger, "ExternalInteger"),
+			SIGNATURE_OF(AttributedFoo, ExternalFloat, "ExternalFloat"),
+			SIGNATURE_OF(AttributedFoo, ExternalString, "ExternalString"),
+			SIGNATURE_OF(AttributedFoo, ExternalVector, "ExternalVector"),
+			SIGNATURE_OF(AttributedFoo, ExternalMatrix, "ExternalMatrix"),
+			SIGNATURE_OF(AttributedFoo, ExternalIntegerArray, "ExternalIntegerArray"),
+			SIGNATURE_OF(AttributedFoo, ExternalFloatArray, "ExternalFloatArray"),
+			SIGNATURE_OF(AttributedFoo, ExternalStringArray, "ExternalStringArray"),
+			SIGNATURE_OF(AttributedFoo, ExternalVectorArray, "ExternalVectorArray"),
+			SIGNATURE_OF(AttributedFoo, ExternalMatrixArray, "ExternalMatrixArray"),
+			Signature::Table("NestedScope"),
+			Signature::Table("NestedScopeArray", ArraySize)
 		};
+		return signatures;
 	}
 
 	gsl::owner<AttributedFoo*> AttributedFoo::Clone() const
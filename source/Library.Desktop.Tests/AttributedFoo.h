@@ -24,20 +24,20 @@ namespace FieaGameEngine
 		int ExternalInteger = 0;
 		float ExternalFloat = 0;
 		std::string ExternalString;
-		glm::vec4 ExternalVector;
-		glm::mat4 ExternalMatrix;
+		glm::vec4 ExternalVector{};
+		glm::mat4 ExternalMatrix{};
 
-		int ExternalIntegerArray[ArraySize];
-		float ExternalFloatArray[ArraySize];
+		int ExternalIntegerArray[ArraySize]{};
+		float ExternalFloatArray[ArraySize]{};
 		std::string ExternalStringArray[ArraySize];
-		glm::vec4 ExternalVectorArray[ArraySize];
-		glm::mat4 ExternalMatrixArray[ArraySize];
+		glm::vec4 ExternalVectorArray[ArraySize]{};
+		glm::mat4 ExternalMatrixArray[ArraySize]{};
 
 		gsl::owner<AttributedFoo*> Clone() const override;
 		bool Equals(const RTTI* rhs) const override;
 		std::string ToString() const override;
 
-		static const Vector<Signature> Signatures();
+		static gsl::span<const Signature> Signatures();
 	};
 
 	ConcreteFactory(AttributedFoo, RTTI)
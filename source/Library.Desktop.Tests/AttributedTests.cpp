@@ -197,6 +197,84 @@ namespace LibraryDesktopTests
 			Assert::IsTrue(foo.IsAuxiliaryAttribute("bruh"));
 		}
 
+		TEST_METHOD(PrescribedAttribute)
+		{
+			AttributedFoo foo;
+			Assert::AreEqual(std::size_t(12), foo.PrescribedAttributeCount());
+
+			std::size_t integerIndex = foo.PrescribedAttributeIndex(NameId("ExternalInteger"s));
+			std::size_t nestedIndex = foo.PrescribedAttributeIndex(NameId("NestedScopeArray"s));
+			Assert::AreEqual(std::size_t(0), integerIndex);
+			Assert::AreEqual(std::size_t(11), nestedIndex);
+			Assert::AreEqual(foo.PrescribedAttributeCount(), foo.PrescribedAttributeIndex(NameId("this"s)));
+
+			foo.AppendAuxiliaryAttribute("bruh");
+			Assert::AreEqual(foo.PrescribedAttributeCount(), foo.PrescribedAttributeIndex(NameId("bruh"s)));
+			Assert::AreEqual(foo.PrescribedAttributeCount(), foo.PrescribedAttributeIndex(NameId()));
+
+			Assert::IsTrue(foo.Find("ExternalInteger"s) == &foo.PrescribedAttribute(integerIndex));
+			Assert::IsTrue(foo.Find("NestedScopeArray"s) == &foo.PrescribedAttribute(nestedIndex));
+			foo.ExternalInteger = 7;
+			Assert::AreEqual(7, foo.PrescribedAttribute(integerIndex).GetInteger());
+			Assert::ExpectException<std::out_of_range>([&foo] { foo.PrescribedAttribute(foo.PrescribedAttributeCount()); });
+
+			AttributedFoo copy(foo);
+			Assert::AreEqual(foo.PrescribedAttributeCount(), copy.PrescribedAttributeCount());
+			Assert::IsTrue(copy.Find("ExternalInteger"s) == &copy.PrescribedAttribute(integerIndex));
+			Assert::AreEqual(7, copy.PrescribedAttribute(integerIndex).GetInteger());
+
+			const AttributedFoo moved(std::move(copy));
+			Assert::AreEqual(std::size_t(0), copy.PrescribedAttributeCount());
+			Assert::IsTrue(moved.Find("NestedScopeArray"s) == &moved.PrescribedAttribute(nestedIndex));
+		}
+
+		TEST_METHOD(SharedLayout)
+		{
+			const Scope::Layout& layout = TypeRegistry::GetInstance().GetLayoutOfType(AttributedFoo::TypeIdClass());
+			Assert::AreEqual(std::size_t(13), layout._names.Size());
+			Assert::IsTrue(NameId("this"s) == layout._names[0]);
+			Assert::AreEqual(std::size_t(1), layout.IndexOf(NameId("ExternalInteger"s)));
+			Assert::AreEqual(layout._names.Size(), layout.IndexOf(NameId("bruh"s)));
+
+			AttributedFoo foo;
+			AttributedFoo other;
+			Assert::IsTrue(foo.Find("ExternalInteger"s) != other.Find("ExternalInteger"s));
+			Assert::IsTrue(&foo == foo["this"s].GetPointer());
+			Assert::IsTrue(layout._names[12] == foo.NameAt(12));
+			Assert::AreEqual(std::size_t(AttributedFoo::ArraySize), foo["NestedScopeArray"s].Size());
+
+			bool wasInserted = true;
+			Assert::IsTrue(&foo.Append(NameId("ExternalFloat"s), wasInserted) == &foo.PrescribedAttribute(1));
+			Assert::IsFalse(wasInserted);
+			Assert::IsTrue(foo.IsPrescribedAttribute("ExternalMatrix"s));
+
+			foo.AppendAuxiliaryAttribute("bruh"s).PushBackInteger(3);
+			Assert::AreEqual(std::size_t(14), foo.Size());
+			Assert::IsTrue(NameId("bruh"s) == foo.NameAt(13));
+			Assert::IsTrue(foo.IsAuxiliaryAttribute("bruh"s));
+			Assert::IsFalse(other.IsAttribute("bruh"s));
+
+			AttributedFoo copy(foo);
+			Assert::AreEqual(std::size_t(14), copy.Size());
+			Assert::AreEqual(3, copy["bruh"s].GetInteger());
+
+			AttributedFoo moved(std::move(copy));
+			Assert::AreEqual(3, moved["bruh"s].GetInteger());
+			Assert::IsTrue(&moved == moved["this"s].GetPointer());
+			Assert::IsNull(copy.Find("ExternalInteger"s));
+
+			other = foo;
+			Assert::AreEqual(std::size_t(14), other.Size());
+			Assert::IsTrue(other.Find("ExternalInteger"s) == &other.PrescribedAttribute(0));
+
+			Scope& cleared = foo;
+			cleared.Clear();
+			Assert::AreEqual(std::size_t(0), foo.Size());
+			Assert::IsNull(foo.Find("ExternalInteger"s));
+			foo.Append("bruh"s).PushBackInteger(1);
+			Assert::IsTrue(NameId("bruh"s) == foo.NameAt(0));
+		}
+
 		TEST_METHOD(Clone)
 		{
 			AttributedFoo foo;
@@ -0,0 +1,177 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "DatumKernels.h"
+#include "Datum.h"
+#include <crtdbg.h>
+#include <cmath>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(DatumKernelsTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"There was a memory leak.");
+			}
+#endif
+		}
+
+		TEST_METHOD(VectorKernels)
+		{
+			// Odd counts exercise the tails left over after the wide loops.
+			for (std::size_t count : { std::size_t(0), std::size_t(1), std::size_t(2), std::size_t(7) })
+			{
+				Datum lhs = MakeVectors(count, 1.0f);
+				Datum rhs = MakeVectors(count, -3.5f);
+				Datum result;
+				result.SetType(Datum::DatumType::Vector);
+				result.Resize(count);
+
+				DatumKernels::Add(lhs.Vectors(), rhs.Vectors(), result.Vectors());
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					Assert::IsTrue(result.GetVector(i) == lhs.GetVector(i) + rhs.GetVector(i));
+				}
+
+				DatumKernels::Multiply(lhs.Vectors(), rhs.Vectors(), result.Vectors());
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					Assert::IsTrue(result.GetVector(i) == lhs.GetVector(i) * rhs.GetVector(i));
+				}
+
+				DatumKernels::Scale(lhs.Vectors(), 0.5f, result.Vectors());
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					Assert::IsTrue(result.GetVector(i) == lhs.GetVector(i) * 0.5f);
+				}
+
+				DatumKernels::Lerp(lhs.Vectors(), rhs.Vectors(), 0.25f, result.Vectors());
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					Assert::IsTrue(Near(result.GetVector(i), lhs.GetVector(i) + (rhs.GetVector(i) - lhs.GetVector(i)) * 0.25f));
+				}
+
+				Datum expected = lhs;
+				DatumKernels::Add(lhs.Vectors(), lhs.Vectors(), lhs.Vectors());
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					Assert::IsTrue(lhs.GetVector(i) == expected.GetVector(i) * 2.0f);
+				}
+			}
+		}
+
+		TEST_METHOD(Transform)
+		{
+			const glm::mat4 matrix(
+				1.0f, 2.0f, 3.0f, 0.0f,
+				-1.0f, 0.5f, 4.0f, 0.0f,
+				0.0f, 2.0f, -2.0f, 0.0f,
+				10.0f, 20.0f, 30.0f, 1.0f);
+
+			Datum values = MakeVectors(9, 2.0f);
+			Datum result;
+			result.SetType(Datum::DatumType::Vector);
+			result.Resize(values.Size());
+
+			DatumKernels::Transform(matrix, values.Vectors(), result.Vectors());
+			for (std::size_t i = 0; i < values.Size(); ++i)
+			{
+				Assert::IsTrue(Near(result.GetVector(i), matrix * values.GetVector(i)));
+			}
+
+			DatumKernels::Transform(matrix, values.Vectors(), values.Vectors());
+			for (std::size_t i = 0; i < values.Size(); ++i)
+			{
+				Assert::IsTrue(Near(result.GetVector(i), values.GetVector(i)));
+			}
+		}
+
+		TEST_METHOD(MatrixMultiply)
+		{
+			Datum lhs;
+			Datum rhs;
+			for (int i = 0; i < 5; ++i)
+			{
+				const float f = static_cast<float>(i);
+				lhs.PushBackMatrix(glm::mat4(glm::vec4(1.0f, f, 0.0f, 0.0f), glm::vec4(0.0f, 2.0f, f, 0.0f), glm::vec4(f, 0.0f, 3.0f, 0.0f), glm::vec4(f, -f, 1.0f, 1.0f)));
+				rhs.PushBackMatrix(glm::mat4(glm::vec4(f, 1.0f, 2.0f, 0.0f), glm::vec4(0.5f, f, 0.0f, 0.0f), glm::vec4(0.0f, 1.0f, f, 0.0f), glm::vec4(4.0f, 5.0f, 6.0f, 1.0f)));
+			}
+			Datum result;
+			result.SetType(Datum::DatumType::Matrix);
+			result.Resize(lhs.Size());
+
+			DatumKernels::Multiply(lhs.Matrices(), rhs.Matrices(), result.Matrices());
+			for (std::size_t i = 0; i < lhs.Size(); ++i)
+			{
+				const glm::mat4 expected = lhs.GetMatrix(i) * rhs.GetMatrix(i);
+				for (int column = 0; column < 4; ++column)
+				{
+					Assert::IsTrue(Near(result.GetMatrix(i)[column], expected[column]));
+				}
+			}
+
+			DatumKernels::Multiply(lhs.Matrices(), rhs.Matrices(), rhs.Matrices());
+			for (std::size_t i = 0; i < lhs.Size(); ++i)
+			{
+				Assert::IsTrue(result.GetMatrix(i) == rhs.GetMatrix(i));
+			}
+		}
+
+		TEST_METHOD(SizeMismatch)
+		{
+			Datum lhs = MakeVectors(4, 1.0f);
+			Datum rhs = MakeVectors(3, 1.0f);
+			Assert::ExpectException<std::runtime_error>([&lhs, &rhs] { DatumKernels::Add(lhs.Vectors(), rhs.Vectors(), lhs.Vectors()); });
+			Assert::ExpectException<std::runtime_error>([&lhs, &rhs] { DatumKernels::Scale(lhs.Vectors(), 2.0f, rhs.Vectors()); });
+			Assert::ExpectException<std::runtime_error>([&lhs, &rhs] { DatumKernels::Transform(glm::mat4(1.0f), lhs.Vectors(), rhs.Vectors()); });
+		}
+
+	private:
+		static Datum MakeVectors(std::size_t count, float seed)
+		{
+			Datum datum;
+			datum.SetType(Datum::DatumType::Vector);
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				const float f = seed + static_cast<float>(i);
+				datum.PushBackVector(glm::vec4(f, f * 2.0f, -f, f * 0.25f));
+			}
+			return datum;
+		}
+
+		static bool Near(const glm::vec4& lhs, const glm::vec4& rhs)
+		{
+			for (int i = 0; i < 4; ++i)
+			{
+				if (std::abs(lhs[i] - rhs[i]) > 1e-4f * (1.0f + std::abs(rhs[i])))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		static _CrtMemState _startMemState;
+	};
+
+	_CrtMemState DatumKernelsTests::_startMemState;
+}
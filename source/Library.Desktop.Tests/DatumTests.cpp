@@ -733,7 +733,7 @@ namespace LibraryDesktopTests
 			{
 				Datum d;
 				d.PushBackFloat(1.0f);
-				Assert::AreEqual("1.000000"s, d.ToString());
+				Assert::AreEqual("1"s, d.ToString());
 			}
 
 			{
@@ -746,14 +746,14 @@ namespace LibraryDesktopTests
 				Datum d;
 				glm::vec4 v(1, 2, 3, 4);
 				d.PushBackVector(v);
-				Assert::AreEqual("bvec4(1.000000, 2.000000, 3.000000, 4.000000)"s, d.ToString());
+				Assert::AreEqual("bvec4(1, 2, 3, 4)"s, d.ToString());
 			}
 
 			{
 				Datum d;
 				glm::mat4 v(1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1);
 				d.PushBackMatrix(v);
-				Assert::AreEqual("mat4x4((1.000000, 1.000000, 1.000000, 1.000000), (1.000000, 1.000000, 1.000000, 1.000000), (1.000000, 1.000000, 1.000000, 1.000000), (1.000000, 1.000000, 1.000000, 1.000000))"s, d.ToString());
+				Assert::AreEqual("mat4x4((1, 1, 1, 1), (1, 1, 1, 1), (1, 1, 1, 1), (1, 1, 1, 1))"s, d.ToString());
 			}
 
 			{
@@ -769,6 +769,57 @@ namespace LibraryDesktopTests
 			}
 		}
 
+		TEST_METHOD(ToChars)
+		{
+			{
+				Datum d;
+				const float values[] = { 0.1f, 1.0f / 3.0f, -123456.789f, 1.17549435e-38f, 3.40282347e+38f, 1e-45f, -0.0f };
+				d.PushBackRange(gsl::span<const float>(values));
+				char buffer[Datum::MaxFormattedLength];
+				for (std::size_t i = 0; i < d.Size(); ++i)
+				{
+					std::size_t length = d.ToChars(buffer, i);
+					float parsed = d.FromStringToFloat(std::string_view(buffer, length));
+					Assert::AreEqual(0, std::memcmp(&parsed, &values[i], sizeof(float)));
+				}
+				Assert::AreEqual("0.1"s, d.ToString(0));
+			}
+
+			{
+				Datum d;
+				const glm::vec4 v(0.1f, -2.5e-7f, 1.0f / 3.0f, 3.40282347e+38f);
+				d.PushBackVector(v);
+				Datum parsed;
+				parsed.PushBackVector(glm::vec4());
+				parsed.SetFromString(d.ToString());
+				Assert::IsTrue(v == parsed.FrontVector());
+
+				glm::mat4 m(-3.40282347e+38f);
+				m[1] = glm::vec4(0.1f, 0.2f, 1.0f / 7.0f, -1e-45f);
+				Datum matrix;
+				matrix.PushBackMatrix(m);
+				char buffer[Datum::MaxFormattedLength];
+				std::size_t length = matrix.ToChars(buffer);
+				Assert::IsTrue(length <= Datum::MaxFormattedLength);
+				Assert::IsTrue(m == matrix.FromStringToMatrix(std::string_view(buffer, length)));
+
+				char small[8];
+				Assert::ExpectException<std::runtime_error>([&matrix, &small] { matrix.ToChars(small); });
+			}
+
+			{
+				Datum d;
+				Assert::AreEqual(-42, d.FromStringToInteger("  -42"));
+				Assert::AreEqual(7, d.FromStringToInteger("+7"));
+				Assert::AreEqual(2.5f, d.FromStringToFloat("2.5e0"));
+				Assert::IsTrue(glm::vec4(1, 2, 3, 4) == d.FromStringToVector("bvec4( 1,2 ,  3, 4 )"));
+				Assert::ExpectException<std::runtime_error>([&d] { d.FromStringToInteger("abc"); });
+				Assert::ExpectException<std::runtime_error>([&d] { d.FromStringToVector("vec4(1, 2, 3, 4)"); });
+				Assert::ExpectException<std::runtime_error>([&d] { d.FromStringToVector("bvec4(1, 2, 3)"); });
+				Assert::ExpectException<std::runtime_error>([&d] { d.FromStringToMatrix("mat4x4((1, 2, 3, 4))"); });
+			}
+		}
+
 		TEST_METHOD(Get)
 		{
 			{
@@ -1223,6 +1274,204 @@ namespace LibraryDesktopTests
 			}
 		}
 
+		TEST_METHOD(InlineStorage)
+		{
+			{
+#if defined(_DEBUG)
+				_CrtMemState before, after, difference;
+				_CrtMemCheckpoint(&before);
+#endif
+				Datum vector;
+				vector.PushBackVector(glm::vec4(1, 2, 3, 4));
+				Datum integers;
+				for (int i = 0; i < 4; ++i)
+				{
+					integers.PushBackInteger(i);
+				}
+				Datum moved(std::move(vector));
+#if defined(_DEBUG)
+				_CrtMemCheckpoint(&after);
+				Assert::IsFalse(_CrtMemDifference(&difference, &before, &after));
+#endif
+				Assert::IsTrue(moved == glm::vec4(1, 2, 3, 4));
+				Assert::AreEqual(std::size_t(0), vector.Size());
+				Assert::AreEqual(3, integers.GetInteger(3));
+			}
+
+			{
+				Datum d;
+				d.PushBackInteger(1);
+				d.PushBackInteger(2);
+				for (int i = 3; i <= 10; ++i)
+				{
+					d.PushBackInteger(i);
+				}
+				Assert::AreEqual(std::size_t(10), d.Size());
+				for (int i = 0; i < 10; ++i)
+				{
+					Assert::AreEqual(i + 1, d.GetInteger(i));
+				}
+
+				d.Resize(3);
+				Assert::AreEqual(std::size_t(3), d.Capacity());
+				Assert::AreEqual(3, d.BackInteger());
+
+				Datum copy(d);
+				Assert::IsTrue(copy == d);
+				Datum assigned;
+				assigned = std::move(copy);
+				Assert::AreEqual(2, assigned.GetInteger(1));
+				assigned.RemoveAt(0);
+				Assert::AreEqual(2, assigned.FrontInteger());
+
+				d.Resize(0);
+				Assert::AreEqual(std::size_t(0), d.Capacity());
+				d.PushBackInteger(7);
+				Assert::AreEqual(7, d.FrontInteger());
+			}
+
+			{
+				Datum strings;
+				strings.PushBackString("a"s);
+				Datum moved(std::move(strings));
+				moved.PushBackString("b"s);
+				Assert::AreEqual("a"s, moved.FrontString());
+				Assert::AreEqual("b"s, moved.BackString());
+			}
+		}
+
+		TEST_METHOD(Spans)
+		{
+			{
+				Datum d;
+				const float values[] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f };
+				d.PushBackRange(gsl::span<const float>(values));
+				Assert::AreEqual(std::size_t(5), d.Size());
+
+				auto floats = d.Floats();
+				Assert::AreEqual(std::size_t(5), floats.size());
+				for (auto& value : floats)
+				{
+					value *= 2.0f;
+				}
+				Assert::AreEqual(10.0f, d.BackFloat());
+
+				const Datum& constDatum = d;
+				float sum = 0.0f;
+				for (float value : constDatum.Floats())
+				{
+					sum += value;
+				}
+				Assert::AreEqual(30.0f, sum);
+
+				d.PushBackRange(d.Floats());
+				Assert::AreEqual(std::size_t(10), d.Size());
+				Assert::AreEqual(2.0f, d.GetFloat(5));
+				Assert::AreEqual(10.0f, d.BackFloat());
+
+				d.AssignRange(d.Floats().subspan(8));
+				Assert::AreEqual(std::size_t(2), d.Size());
+				Assert::AreEqual(8.0f, d.FrontFloat());
+
+				d.AssignRange(gsl::span<const float>(values, 3));
+				Assert::AreEqual(std::size_t(3), d.Size());
+				Assert::AreEqual(3.0f, d.BackFloat());
+
+				Assert::ExpectException<std::runtime_error>([&d] { d.Integers(); });
+				Assert::ExpectException<std::runtime_error>([&d] { d.PushBackRange(gsl::span<const int>()); });
+			}
+
+			{
+				Datum d;
+				const std::string values[] = { "a"s, "b"s, "c"s };
+				d.PushBackRange(gsl::span<const std::string>(values));
+				d.PushBackRange(d.Strings().first(2));
+				Assert::AreEqual(std::size_t(5), d.Size());
+				Assert::AreEqual("b"s, d.BackString());
+
+				d.AssignRange(d.Strings().subspan(1, 2));
+				Assert::AreEqual(std::size_t(2), d.Size());
+				Assert::AreEqual("b"s, d.FrontString());
+				Assert::AreEqual("c"s, d.BackString());
+			}
+
+			{
+				glm::vec4 external[2];
+				Datum d;
+				d.SetStorageVector(external, 2);
+				const glm::vec4 values[] = { glm::vec4(1), glm::vec4(2) };
+				d.AssignRange(gsl::span<const glm::vec4>(values));
+				Assert::IsTrue(external[1] == glm::vec4(2));
+				Assert::ExpectException<std::runtime_error>([&d, &values] { d.AssignRange(gsl::span<const glm::vec4>(values, 1)); });
+				Assert::ExpectException<std::runtime_error>([&d, &values] { d.PushBackRange(gsl::span<const glm::vec4>(values)); });
+				Assert::AreEqual(std::size_t(2), d.Vectors().size());
+			}
+		}
+
+		TEST_METHOD(CopyOnWrite)
+		{
+			{
+				Datum prototype;
+				const float values[] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f };
+				prototype.PushBackRange(gsl::span<const float>(values));
+
+				// Copies read the prototype's storage until they write.
+				Datum first(prototype);
+				Datum second;
+				second = prototype;
+				const Datum& constFirst = first;
+				Assert::IsTrue(constFirst.Floats().data() == std::as_const(prototype).Floats().data());
+				Assert::IsTrue(std::as_const(second).Floats().data() == std::as_const(prototype).Floats().data());
+
+				first.SetFloat(10.0f, 2);
+				Assert::IsFalse(constFirst.Floats().data() == std::as_const(prototype).Floats().data());
+				Assert::AreEqual(10.0f, first.GetFloat(2));
+				Assert::AreEqual(3.0f, prototype.GetFloat(2));
+				Assert::AreEqual(3.0f, second.GetFloat(2));
+
+				second.PushBackFloat(7.0f);
+				prototype.RemoveAt(0);
+				Assert::AreEqual(std::size_t(7), second.Size());
+				Assert::AreEqual(std::size_t(5), prototype.Size());
+				Assert::AreEqual(1.0f, second.FrontFloat());
+
+				// A span handed out for writing keeps its storage private from then on.
+				auto floats = first.Floats();
+				Datum third(first);
+				floats[0] = 20.0f;
+				Assert::AreEqual(1.0f, third.FrontFloat());
+				Assert::AreEqual(20.0f, first.FrontFloat());
+
+				Datum cleared(prototype);
+				cleared.Clear();
+				Assert::AreEqual(std::size_t(0), cleared.Size());
+				Assert::AreEqual(prototype.Capacity(), cleared.Capacity());
+				Assert::AreEqual(std::size_t(5), prototype.Size());
+				cleared.PushBackFloat(1.0f);
+				Assert::AreEqual(2.0f, prototype.FrontFloat());
+			}
+
+			{
+				Datum prototype;
+				prototype = "alpha"s;
+				prototype.PushBackString("beta"s);
+				prototype.PushBackString("gamma"s);
+				Datum copy(prototype);
+				Datum moved(std::move(copy));
+				moved.SetString("delta"s, 1);
+				Assert::AreEqual("beta"s, prototype.GetString(1));
+				Assert::AreEqual("delta"s, moved.GetString(1));
+
+				Datum shrunk(prototype);
+				shrunk.Resize(1);
+				Assert::AreEqual(std::size_t(3), prototype.Size());
+				Assert::AreEqual("gamma"s, prototype.BackString());
+				Datum released(prototype);
+				released.Resize(0);
+				Assert::AreEqual("alpha"s, prototype.FrontString());
+			}
+		}
+
 	private:
 		static _CrtMemState _startMemState;
 	};
@@ -0,0 +1,358 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "FlatHashmap.h"
+#include "Foo.h"
+#include <crtdbg.h>
+#include "ToStringSpecializations.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace Microsoft::VisualStudio::CppUnitTestFramework
+{
+	template<>
+	std::wstring ToString<FlatHashmap<std::string, Foo>::Iterator>(const FlatHashmap<std::string, Foo>::Iterator& it)
+	{
+		try
+		{
+			return ToString((*it).first);
+		}
+		catch (const std::exception&)
+		{
+			return L"end()"s;
+		}
+	}
+
+	template<>
+	std::wstring ToString<FlatHashmap<std::string, Foo>::ConstIterator>(const FlatHashmap<std::string, Foo>::ConstIterator& it)
+	{
+		try
+		{
+			return ToString((*it).first);
+		}
+		catch (const std::exception&)
+		{
+			return L"cend()"s;
+		}
+	}
+}
+
+namespace
+{
+	/// Hashes and compares strings ignoring ASCII case.
+	struct CaseInsensitiveHash final
+	{
+		std::size_t operator()(const std::string& key) const
+		{
+			std::string lower(key);
+			std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+			return HashFunctor<std::string>{}(lower);
+		}
+	};
+
+	struct CaseInsensitiveEqual final
+	{
+		bool operator()(const std::string& lhs, const std::string& rhs) const
+		{
+			return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin(),
+				[](unsigned char a, unsigned char b) { return std::tolower(a) == std::tolower(b); });
+		}
+	};
+}
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(FlatHashmapTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"There was a memory leak.");
+			}
+#endif
+		}
+
+		TEST_METHOD(IteratorConstructors)
+		{
+			FlatHashmap<std::string, Foo>::Iterator it;
+
+			Assert::ExpectException<std::runtime_error>([&it]() { *it; });
+			Assert::ExpectException<std::runtime_error>([&it]() { ++it; });
+
+			FlatHashmap<std::string, Foo> myMap;
+			Assert::AreEqual(std::size_t(11), myMap.BucketCount());
+			it = myMap.begin();
+			Assert::AreEqual(myMap.end(), it);
+			Assert::ExpectException<std::runtime_error>([&it]() { *it; });
+			++it;
+			Assert::AreEqual(myMap.end(), it);
+
+			FlatHashmap<std::string, Foo>::ConstIterator constIt = it;
+			Assert::AreEqual(myMap.cend(), constIt);
+			Assert::ExpectException<std::runtime_error>([&constIt]() { *constIt; });
+		}
+
+		TEST_METHOD(Iteration)
+		{
+			FlatHashmap<std::string, Foo> myMap;
+			for (int i = 0; i < 50; ++i)
+			{
+				myMap.Insert(std::make_pair(std::to_string(i), Foo(i)));
+			}
+
+			int sum = 0;
+			std::size_t count = 0;
+			for (auto it = myMap.begin(); it != myMap.end(); ++it)
+			{
+				sum += (*it).second.Data();
+				++count;
+			}
+			Assert::AreEqual(std::size_t(50), count);
+			Assert::AreEqual(1225, sum);
+
+			count = 0;
+			for (auto it = myMap.cbegin(); it != myMap.cend(); it++)
+			{
+				++count;
+			}
+			Assert::AreEqual(std::size_t(50), count);
+		}
+
+		TEST_METHOD(Constructor)
+		{
+			FlatHashmap<std::string, Foo> myMap;
+			Assert::AreEqual(std::size_t(0), myMap.Size());
+			Assert::AreEqual(std::size_t(11), myMap.BucketCount());
+			Assert::AreEqual(float(0), myMap.LoadFactor());
+
+			Assert::ExpectException<std::runtime_error>([]() { FlatHashmap<std::string, Foo> newMap(1); });
+
+			FlatHashmap<std::string, Foo> listMap{ { "Andrew", Foo(1) }, { "Drew", Foo(2) } };
+			Assert::AreEqual(std::size_t(2), listMap.Size());
+			Assert::AreEqual(Foo(2), listMap.At("Drew"));
+		}
+
+		TEST_METHOD(CopySemantics)
+		{
+			FlatHashmap<std::string, Foo> myMap;
+			myMap.Insert(std::make_pair("Andrew", Foo(1)));
+			myMap.Insert(std::make_pair("Drew", Foo(2)));
+			myMap.Insert(std::make_pair("AJ", Foo(3)));
+
+			FlatHashmap<std::string, Foo> copy(myMap);
+			Assert::AreEqual(std::size_t(3), copy.Size());
+			Assert::AreEqual(Foo(3), copy.At("AJ"));
+			Assert::AreNotSame(myMap.At("AJ"), copy.At("AJ"));
+
+			FlatHashmap<std::string, Foo> assigned;
+			assigned.Insert(std::make_pair("Myself", Foo(4)));
+			assigned = myMap;
+			Assert::AreEqual(std::size_t(3), assigned.Size());
+			Assert::IsFalse(assigned.ContainsKey("Myself"));
+			Assert::AreEqual(Foo(1), assigned.At("Andrew"));
+		}
+
+		TEST_METHOD(MoveSemantics)
+		{
+			FlatHashmap<std::string, Foo> myMap;
+			myMap.Insert(std::make_pair("Andrew", Foo(1)));
+			myMap.Insert(std::make_pair("Drew", Foo(2)));
+			Foo* address = &myMap.At("Drew");
+
+			FlatHashmap<std::string, Foo> moved = std::move(myMap);
+			Assert::AreEqual(std::size_t(2), moved.Size());
+			Assert::AreEqual(address, &moved.At("Drew"));
+
+			FlatHashmap<std::string, Foo> assigned;
+			assigned = std::move(moved);
+			Assert::AreEqual(std::size_t(2), assigned.Size());
+			Assert::AreEqual(address, &assigned.At("Drew"));
+
+			for (int i = 0; i < 50; ++i)
+			{
+				assigned.Insert(std::make_pair(std::to_string(i), Foo(i)));
+				myMap.Insert(std::make_pair(std::to_string(i), Foo(i)));
+			}
+			Assert::AreEqual(std::size_t(52), assigned.Size());
+			Assert::AreEqual(std::size_t(50), myMap.Size());
+			Assert::AreEqual(address, &assigned.At("Drew"));
+		}
+
+		TEST_METHOD(FindAndInsert)
+		{
+			FlatHashmap<std::string, Foo> myMap;
+			Assert::AreEqual(myMap.end(), myMap.Find("Andrew"));
+
+			auto [it, inserted] = myMap.Insert(std::make_pair("Andrew", Foo(1)));
+			Assert::IsTrue(inserted);
+			Assert::AreEqual("Andrew"s, (*it).first);
+			Assert::IsFalse(myMap.Insert(std::make_pair("Andrew", Foo(5))).second);
+			Assert::AreEqual(Foo(1), myMap.At("Andrew"));
+
+			myMap.Insert(std::make_pair("Drew", Foo(2)));
+			Assert::AreEqual(Foo(2), (*myMap.Find("Drew")).second);
+			Assert::AreEqual(myMap.end(), myMap.Find("Myself"));
+
+			const FlatHashmap<std::string, Foo> myConstMap = myMap;
+			Assert::AreEqual(Foo(1), (*myConstMap.Find("Andrew")).second);
+			Assert::AreEqual(myConstMap.cend(), myConstMap.Find("Myself"));
+			Assert::ExpectException<std::runtime_error>([&myConstMap]() { myConstMap.At("Myself"); });
+		}
+
+		TEST_METHOD(BracketOperator)
+		{
+			FlatHashmap<std::string, Foo> myMap;
+			myMap.Insert(std::make_pair("Andrew", Foo(1)));
+			Assert::AreEqual(Foo(1), myMap["Andrew"]);
+			Assert::AreEqual(Foo(), myMap["Myself"]);
+			Assert::AreEqual(std::size_t(2), myMap.Size());
+		}
+
+		TEST_METHOD(Remove)
+		{
+			FlatHashmap<std::string, Foo> myMap(4);
+			for (int i = 0; i < 100; ++i)
+			{
+				myMap.Insert(std::make_pair(std::to_string(i), Foo(i)));
+			}
+
+			for (int i = 0; i < 100; i += 2)
+			{
+				Assert::IsTrue(myMap.Remove(std::to_string(i)));
+			}
+			Assert::IsFalse(myMap.Remove("0"s));
+			Assert::AreEqual(std::size_t(50), myMap.Size());
+
+			for (int i = 0; i < 100; ++i)
+			{
+				Assert::AreEqual(i % 2 == 1, myMap.ContainsKey(std::to_string(i)));
+			}
+
+			auto it = myMap.Find("1");
+			Assert::IsTrue(myMap.Remove(it));
+			Assert::IsFalse(myMap.Remove(myMap.end()));
+			Assert::AreEqual(std::size_t(49), myMap.Size());
+
+			FlatHashmap<std::string, Foo> otherMap;
+			Assert::ExpectException<std::runtime_error>([&myMap, &otherMap]() { myMap.Remove(otherMap.begin()); });
+		}
+
+		TEST_METHOD(Clear)
+		{
+			FlatHashmap<std::string, Foo> myMap;
+			myMap.Insert(std::make_pair("Andrew", Foo(1)));
+			myMap.Insert(std::make_pair("Drew", Foo(2)));
+			myMap.Clear();
+			Assert::AreEqual(std::size_t(0), myMap.Size());
+			Assert::AreEqual(std::size_t(11), myMap.BucketCount());
+			Assert::ExpectException<std::runtime_error>([&myMap]() { myMap.At("Andrew"); });
+
+			myMap.Insert(std::make_pair("AJ", Foo(3)));
+			Assert::AreEqual(Foo(3), myMap.At("AJ"));
+		}
+
+		TEST_METHOD(LoadFactor)
+		{
+			FlatHashmap<std::string, Foo> myMap(4);
+			Assert::AreEqual(0.875f, myMap.MaxLoadFactor());
+			myMap.Insert(std::make_pair("Andrew", Foo(1)));
+			myMap.Insert(std::make_pair("Drew", Foo(2)));
+			Assert::AreEqual(0.5f, myMap.LoadFactor());
+
+			Assert::ExpectException<std::runtime_error>([&myMap]() { myMap.SetMaxLoadFactor(0.0f); });
+			Assert::ExpectException<std::runtime_error>([&myMap]() { myMap.SetMaxLoadFactor(1.0f); });
+
+			myMap.SetMaxLoadFactor(0.25f);
+			Assert::AreEqual(std::size_t(8), myMap.BucketCount());
+
+			for (int i = 0; i < 100; ++i)
+			{
+				myMap.Insert(std::make_pair(std::to_string(i), Foo(i)));
+				Assert::IsTrue(myMap.LoadFactor() <= myMap.MaxLoadFactor());
+			}
+		}
+
+		TEST_METHOD(StableReferences)
+		{
+			FlatHashmap<std::string, Foo> myMap(2);
+			Vector<std::pair<const std::string, Foo>*> addresses;
+			for (int i = 0; i < 200; ++i)
+			{
+				addresses.PushBack(&*myMap.Insert(std::make_pair(std::to_string(i), Foo(i))).first);
+			}
+
+			for (int i = 0; i < 200; i += 3)
+			{
+				myMap.Remove(std::to_string(i));
+			}
+			myMap.Rehash(997);
+
+			for (int i = 0; i < 200; ++i)
+			{
+				if (i % 3 != 0)
+				{
+					Assert::IsTrue(addresses[i] == &*myMap.Find(std::to_string(i)));
+					Assert::AreEqual(Foo(i), addresses[i]->second);
+				}
+			}
+
+			myMap.Rehash(3);
+			Assert::AreEqual(std::size_t(152), myMap.BucketCount());
+		}
+
+		TEST_METHOD(Reserve)
+		{
+			FlatHashmap<std::string, Foo> myMap;
+			myMap.Reserve(100);
+			std::size_t bucketCount = myMap.BucketCount();
+			Assert::IsTrue(bucketCount >= 115);
+
+			for (int i = 0; i < 100; ++i)
+			{
+				myMap.Insert(std::make_pair(std::to_string(i), Foo(i)));
+			}
+			Assert::AreEqual(bucketCount, myMap.BucketCount());
+
+			myMap.Reserve(10);
+			Assert::AreEqual(bucketCount, myMap.BucketCount());
+		}
+
+		TEST_METHOD(Policies)
+		{
+			using map_type = FlatHashmap<std::string, Foo, CaseInsensitiveHash, CaseInsensitiveEqual>;
+			map_type myMap;
+			myMap.Insert(std::make_pair("Health"s, Foo(1)));
+			myMap["MANA"s] = Foo(2);
+
+			Assert::IsTrue(myMap.ContainsKey("health"s));
+			Assert::AreEqual(Foo(2), myMap.At("mana"s));
+			Assert::IsFalse(myMap.Insert(std::make_pair("HEALTH"s, Foo(3))).second);
+			Assert::AreEqual(std::size_t(2), myMap.Size());
+
+			const map_type copy = myMap;
+			Assert::IsTrue(copy.Find("Mana"s) != copy.cend());
+			Assert::IsTrue(myMap.Remove("hEaLtH"s));
+			Assert::AreEqual(std::size_t(1), myMap.Size());
+		}
+
+	private:
+		static _CrtMemState _startMemState;
+	};
+
+	_CrtMemState FlatHashmapTests::_startMemState;
+}
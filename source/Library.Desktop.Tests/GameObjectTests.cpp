@@ -52,6 +52,80 @@ namespace LibraryDesktopTests
 			Assert::IsNotNull(gameObject.Find("Children"));
 		}
 
+		TEST_METHOD(PrescribedHandles)
+		{
+			GameObject gameObject;
+			Assert::IsTrue(gameObject.Find("Children"s) == &gameObject.Children());
+			Assert::IsTrue(gameObject.Find("Actions"s) == &gameObject.Actions());
+
+			gameObject.AppendAuxiliaryAttribute("Extra"s);
+			gameObject.Adopt(*(new GameObject()), "Children"s);
+			Assert::AreEqual(std::size_t(1), gameObject.Children().Size());
+
+			GameObject copy(gameObject);
+			Assert::IsTrue(copy.Find("Children"s) == &copy.Children());
+			Assert::IsTrue(copy.Find("Actions"s) == &copy.Actions());
+			Assert::AreEqual(std::size_t(1), copy.Children().Size());
+			Assert::IsTrue(&copy.GetChild(0) != &gameObject.GetChild(0));
+		}
+
+		TEST_METHOD(TransformStoreBinding)
+		{
+			TransformStore store;
+			{
+				GameObject gameObject;
+				gameObject.Position() = glm::vec4(1, 2, 3, 1);
+				gameObject.Scale() = glm::vec4(1);
+				Assert::IsNull(gameObject.GetTransformStore());
+				Assert::IsTrue(&gameObject.Find("Position"s)->GetVector() == &gameObject.Position());
+
+				gameObject.SetTransformStore(&store);
+				Assert::IsTrue(gameObject.GetTransformStore() == &store);
+				Assert::AreEqual(std::size_t(1), store.Size());
+				Assert::IsTrue(&gameObject.Position() == &store.Position(gameObject.TransformHandle()));
+				Assert::IsTrue(&gameObject.Find("Position"s)->GetVector() == &gameObject.Position());
+				Assert::IsTrue(&gameObject.Find("Rotation"s)->GetVector() == &gameObject.Rotation());
+				Assert::IsTrue(&gameObject.Find("Scale"s)->GetVector() == &gameObject.Scale());
+				Assert::AreEqual(glm::vec4(1, 2, 3, 1), gameObject.Position());
+				Assert::AreEqual(glm::vec4(1), gameObject.Scale());
+
+				gameObject.Find("Rotation"s)->SetFromString("bvec4(0, 1, 0, 0)"s);
+				Assert::AreEqual(glm::vec4(0, 1, 0, 0), store.Rotation(gameObject.TransformHandle()));
+
+				GameObject copy(gameObject);
+				Assert::AreEqual(std::size_t(2), store.Size());
+				Assert::IsTrue(copy.TransformHandle() != gameObject.TransformHandle());
+				Assert::IsTrue(&copy.Find("Position"s)->GetVector() == &copy.Position());
+				Assert::IsTrue(copy.Equals(&gameObject));
+
+				const TransformStore::Handle handle = copy.TransformHandle();
+				GameObject moved(std::move(copy));
+				Assert::AreEqual(std::size_t(2), store.Size());
+				Assert::AreEqual(handle, moved.TransformHandle());
+				Assert::IsNull(copy.GetTransformStore());
+				Assert::IsTrue(&moved.Find("Scale"s)->GetVector() == &store.Scale(handle));
+
+				GameObject unbound;
+				unbound = moved;
+				Assert::IsNull(unbound.GetTransformStore());
+				Assert::IsTrue(&unbound.Find("Position"s)->GetVector() == &unbound.Position());
+				Assert::AreEqual(glm::vec4(0, 1, 0, 0), unbound.Rotation());
+
+				GameObject bound(store);
+				Assert::AreEqual(std::size_t(3), store.Size());
+				bound = std::move(moved);
+				Assert::AreEqual(std::size_t(2), store.Size());
+				Assert::AreEqual(handle, bound.TransformHandle());
+				Assert::IsTrue(&bound.Find("Position"s)->GetVector() == &store.Position(handle));
+
+				gameObject.SetTransformStore(nullptr);
+				Assert::AreEqual(std::size_t(1), store.Size());
+				Assert::IsTrue(&gameObject.Find("Position"s)->GetVector() == &gameObject.Position());
+				Assert::AreEqual(glm::vec4(1, 2, 3, 1), gameObject.Position());
+			}
+			Assert::AreEqual(std::size_t(0), store.Size());
+		}
+
 		TEST_METHOD(TableParseGameObject)
 		{
 			GameObject scope;
@@ -81,17 +155,17 @@ namespace LibraryDesktopTests
 			Assert::AreEqual(Datum::DatumType::Vector, scope.Find("Position")->Type());
 			glm::vec4 a(1, 2, 3, 4);
 			Assert::AreEqual(a, scope.Find("Position")->FrontVector());
-			Assert::AreEqual(a, scope.Position);
+			Assert::AreEqual(a, scope.Position());
 
 			Assert::AreEqual(Datum::DatumType::Vector, scope.Find("Rotation")->Type());
 			glm::vec4 b(2, 2, 3, 4);
 			Assert::AreEqual(b, scope.Find("Rotation")->FrontVector());
-			Assert::AreEqual(b, scope.Rotation);
+			Assert::AreEqual(b, scope.Rotation());
 
 			Assert::AreEqual(Datum::DatumType::Vector, scope.Find("Scale")->Type());
 			glm::vec4 c(3, 2, 3, 4);
 			Assert::AreEqual(c, scope.Find("Scale")->FrontVector());
-			Assert::AreEqual(c, scope.Scale);
+			Assert::AreEqual(c, scope.Scale());
 
 			Assert::AreEqual(Datum::DatumType::Table, scope.Find("Children")->Type());
 			Assert::AreEqual(std::size_t(2), scope.Find("Children")->Size());
@@ -0,0 +1,306 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "GameState.h"
+#include "GameObject.h"
+#include "ActionIncrement.h"
+#include "ActionCreateAction.h"
+#include "ActionDestroyAction.h"
+#include <crtdbg.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace LibraryDesktopTests
+{
+	/// <summary>
+	/// Appends its name to a shared log when updated, and can graft a new child onto another object.
+	/// </summary>
+	class RecordingGameObject final : public GameObject
+	{
+	public:
+		RecordingGameObject(const std::string& name, Vector<std::string>& log) :
+			_log(&log)
+		{
+			Name = name;
+		}
+
+		void UpdateSelf(const GameTime& time) override
+		{
+			GameObject::UpdateSelf(time);
+			_log->PushBack(Name);
+			if (GraftOnto != nullptr)
+			{
+				GraftOnto->Adopt(*(new RecordingGameObject(Name + "+"s, *_log)), "Children"s);
+				GraftOnto = nullptr;
+			}
+		}
+
+		GameObject* GraftOnto{ nullptr };
+
+	private:
+		Vector<std::string>* _log;
+	};
+
+	TEST_CLASS(GameStateTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"There was a memory leak.");
+			}
+#endif
+		}
+
+		TEST_METHOD(MatchesRecursiveOrder)
+		{
+			GameTime time;
+			Vector<std::string> recursiveLog;
+			Vector<std::string> flattenedLog;
+			RecordingGameObject recursiveRoot("Root"s, recursiveLog);
+			RecordingGameObject flattenedRoot("Root"s, flattenedLog);
+			BuildScene(recursiveRoot, recursiveLog);
+			BuildScene(flattenedRoot, flattenedLog);
+
+			GameState state(&flattenedRoot);
+			Assert::IsTrue(state.SceneRoot() == &flattenedRoot);
+			for (int frame = 0; frame < 2; ++frame)
+			{
+				recursiveRoot.Update(time);
+				state.Update(time);
+			}
+
+			Assert::AreEqual(std::size_t(14), flattenedLog.Size());
+			Assert::AreEqual("A1"s, flattenedLog.Front());
+			Assert::AreEqual("Root"s, flattenedLog[6]);
+			Assert::IsTrue(recursiveLog == flattenedLog);
+		}
+
+		TEST_METHOD(HierarchyChangesDuringUpdate)
+		{
+			GameTime time;
+			Vector<std::string> recursiveLog;
+			Vector<std::string> flattenedLog;
+			RecordingGameObject recursiveRoot("Root"s, recursiveLog);
+			RecordingGameObject flattenedRoot("Root"s, flattenedLog);
+			BuildScene(recursiveRoot, recursiveLog);
+			BuildScene(flattenedRoot, flattenedLog);
+
+			// A1 grafts onto C, which the walk has not reached yet, so the graft is updated this frame.
+			// B1 grafts onto itself after its children were visited, so the graft waits for the next frame.
+			static_cast<RecordingGameObject&>(recursiveRoot.GetChild(0).GetChild(0)).GraftOnto = &recursiveRoot.GetChild(2);
+			static_cast<RecordingGameObject&>(flattenedRoot.GetChild(0).GetChild(0)).GraftOnto = &flattenedRoot.GetChild(2);
+			static_cast<RecordingGameObject&>(recursiveRoot.GetChild(1).GetChild(0)).GraftOnto = &recursiveRoot.GetChild(1).GetChild(0);
+			static_cast<RecordingGameObject&>(flattenedRoot.GetChild(1).GetChild(0)).GraftOnto = &flattenedRoot.GetChild(1).GetChild(0);
+
+			GameState state;
+			state.SetSceneRoot(&flattenedRoot);
+			for (int frame = 0; frame < 2; ++frame)
+			{
+				recursiveRoot.Update(time);
+				state.Update(time);
+				Assert::IsTrue(recursiveLog == flattenedLog);
+			}
+			Assert::AreEqual(std::size_t(8 + 9), flattenedLog.Size());
+		}
+
+		TEST_METHOD(NoSceneRoot)
+		{
+			GameState state;
+			JobSystem jobs(1);
+			state.Update(GameTime());
+			state.Update(GameTime(), jobs);
+			Assert::IsNull(state.SceneRoot());
+		}
+
+		TEST_METHOD(ParallelUpdate)
+		{
+			const std::size_t childCount = 200;
+			GameTime time;
+			GameObject serialRoot;
+			GameObject parallelRoot;
+			BuildCounterScene(serialRoot, childCount);
+			BuildCounterScene(parallelRoot, childCount);
+
+			GameState serialState(&serialRoot);
+			GameState parallelState(&parallelRoot);
+			JobSystem jobs(3);
+			for (int frame = 0; frame < 5; ++frame)
+			{
+				serialState.Update(time);
+				parallelState.Update(time, jobs);
+			}
+
+			for (std::size_t i = 0; i < childCount; ++i)
+			{
+				const std::string counter = "Counter"s + std::to_string(i);
+				Assert::AreEqual(serialRoot.GetChild(i)[counter].GetFloat(), parallelRoot.GetChild(i)[counter].GetFloat());
+			}
+			Assert::AreEqual(10.0f, parallelRoot.GetChild(0)["Counter0"s].GetFloat());
+			Assert::AreEqual(15.0f, parallelRoot.GetChild(60)["Counter60"s].GetFloat());
+			Assert::AreEqual(std::size_t(2 + 5), parallelRoot.GetChild(100).Actions().Size());
+		}
+
+		TEST_METHOD(ParallelUpdateAfterRetarget)
+		{
+			const std::size_t childCount = 64;
+			const std::size_t actionCount = 100;
+			GameTime time;
+			GameObject root;
+			for (std::size_t i = 0; i < childCount; ++i)
+			{
+				const std::string counter = "Counter"s + std::to_string(i);
+				auto* child = new GameObject();
+				root.Adopt(*child, "Children"s);
+				child->AppendAuxiliaryAttribute(counter).PushBackFloat(0.0f);
+				for (std::size_t j = 0; j < actionCount; ++j)
+				{
+					static_cast<ActionIncrement*>(child->CreateAction("ActionIncrement"s, "Increment"s))->SetTarget(counter);
+				}
+			}
+
+			GameState state(&root);
+			JobSystem jobs(3);
+			state.Update(time, jobs);
+
+			// Retargeting changes no structure, yet every child now increments child 0's counter.
+			for (std::size_t i = 1; i < childCount; ++i)
+			{
+				for (std::size_t j = 0; j < actionCount; ++j)
+				{
+					static_cast<ActionIncrement&>(root.GetChild(i).GetAction(j)).SetTarget("Counter0"s);
+				}
+			}
+			state.Update(time, jobs);
+
+			Assert::AreEqual(float(childCount * actionCount + actionCount), root.GetChild(0)["Counter0"s].GetFloat());
+			Assert::AreEqual(float(actionCount), root.GetChild(1)["Counter1"s].GetFloat());
+		}
+
+		TEST_METHOD(ParallelUpdateCreatesActions)
+		{
+			const std::size_t childCount = 64;
+			GameTime time;
+			GameObject root;
+			for (std::size_t i = 0; i < childCount; ++i)
+			{
+				auto* child = new GameObject();
+				root.Adopt(*child, "Children"s);
+				auto* create = static_cast<ActionCreateAction*>(child->CreateAction("ActionCreateAction"s, "Create"s));
+				create->SetClassName(i % 2 == 0 ? "ActionDestroyAction"s : "ActionCreateAction"s);
+				create->SetInstanceName("Created"s);
+			}
+
+			// Both created classes prescribe a nested Actions scope, built on the worker threads.
+			GameState state(&root);
+			JobSystem jobs(3);
+			state.Update(time, jobs);
+
+			for (std::size_t i = 0; i < childCount; ++i)
+			{
+				GameObject& child = root.GetChild(i);
+				Assert::AreEqual(std::size_t(2), child.Actions().Size());
+				Action& created = child.GetAction(1);
+				Assert::AreEqual("Created"s, created.Name());
+				Assert::IsTrue(i % 2 == 0 ? created.Is(ActionDestroyAction::TypeIdClass()) : created.Is(ActionCreateAction::TypeIdClass()));
+			}
+		}
+
+		TEST_METHOD(ParallelUpdateRebuildsAfterLocalChange)
+		{
+			GameTime time;
+			Vector<std::string> serialLog;
+			Vector<std::string> parallelLog;
+			RecordingGameObject serialRoot("Root"s, serialLog);
+			RecordingGameObject parallelRoot("Root"s, parallelLog);
+			BuildScene(serialRoot, serialLog);
+			BuildScene(parallelRoot, parallelLog);
+
+			// Every object is local, so A and B go out in one batch, and B1 grafts onto itself within it.
+			// Without workers the batch runs on this thread, so the shared log stays ordered.
+			static_cast<RecordingGameObject&>(serialRoot.GetChild(1).GetChild(0)).GraftOnto = &serialRoot.GetChild(1).GetChild(0);
+			static_cast<RecordingGameObject&>(parallelRoot.GetChild(1).GetChild(0)).GraftOnto = &parallelRoot.GetChild(1).GetChild(0);
+
+			GameState serialState(&serialRoot);
+			GameState parallelState(&parallelRoot);
+			JobSystem jobs(0);
+			for (int frame = 0; frame < 2; ++frame)
+			{
+				serialState.Update(time);
+				parallelState.Update(time, jobs);
+				Assert::IsTrue(serialLog == parallelLog);
+			}
+
+			Assert::AreEqual(std::size_t(7 + 8), parallelLog.Size());
+			Assert::AreEqual("Root"s, parallelLog[6]);
+			Assert::AreEqual("B1+"s, parallelLog[10]);
+			Assert::AreEqual(std::size_t(1), parallelRoot.GetChild(1).GetChild(0).Children().Size());
+		}
+
+	private:
+		/// <summary>
+		/// Root
+		///   A
+		///     A1
+		///     A2
+		///   B
+		///     B1
+		///   C
+		/// </summary>
+		static void BuildScene(GameObject& root, Vector<std::string>& log)
+		{
+			auto* a = new RecordingGameObject("A"s, log);
+			auto* b = new RecordingGameObject("B"s, log);
+			root.Adopt(*a, "Children"s);
+			root.Adopt(*b, "Children"s);
+			root.Adopt(*(new RecordingGameObject("C"s, log)), "Children"s);
+			a->Adopt(*(new RecordingGameObject("A1"s, log)), "Children"s);
+			a->Adopt(*(new RecordingGameObject("A2"s, log)), "Children"s);
+			b->Adopt(*(new RecordingGameObject("B1"s, log)), "Children"s);
+		}
+
+		/// <summary>
+		/// Each child of root, and one grandchild under it, increments a counter on that child.
+		/// Child 50 also increments child 60's counter, so it is updated serially between parallel batches.
+		/// Child 100 creates an action every update, which only goes through its action queue.
+		/// </summary>
+		static void BuildCounterScene(GameObject& root, std::size_t childCount)
+		{
+			for (std::size_t i = 0; i < childCount; ++i)
+			{
+				const std::string counter = "Counter"s + std::to_string(i);
+				auto* child = new GameObject();
+				root.Adopt(*child, "Children"s);
+				child->AppendAuxiliaryAttribute(counter).PushBackFloat(0.0f);
+				static_cast<ActionIncrement*>(child->CreateAction("ActionIncrement"s, "Increment"s))->SetTarget(counter);
+
+				auto* grandchild = new GameObject();
+				child->Adopt(*grandchild, "Children"s);
+				static_cast<ActionIncrement*>(grandchild->CreateAction("ActionIncrement"s, "Increment"s))->SetTarget(counter);
+			}
+
+			static_cast<ActionIncrement*>(root.GetChild(50).CreateAction("ActionIncrement"s, "Reach"s))->SetTarget("Counter60"s);
+			auto* create = static_cast<ActionCreateAction*>(root.GetChild(100).CreateAction("ActionCreateAction"s, "Create"s));
+			create->SetClassName("ActionIncrement"s);
+			create->SetInstanceName("Created"s);
+		}
+
+		static _CrtMemState _startMemState;
+	};
+
+	_CrtMemState GameStateTests::_startMemState;
+}
@@ -2,6 +2,7 @@
 #include "CppUnitTest.h"
 #include "HashFunctor.h"
 #include "Foo.h"
+#include "Vector.h"
 #include <crtdbg.h>
 #include "ToStringSpecializations.h"
 
@@ -35,16 +36,16 @@ namespace LibraryDesktopTests
 #endif
 		}
 
-		TEST_METHOD(AdditiveHashStdString)
+		TEST_METHOD(ByteHashStdString)
 		{
 			HashFunctor<std::string> myFunctor;
 			const std::string myName = "Andrew"s;
 			const std::string myName2 = "Andrew"s;
 			const std::string myName3 = "Drew"s;
 
-			std::size_t result = myFunctor.AdditiveHash(reinterpret_cast<const std::uint8_t*>(myName.c_str()), myName.size());
-			std::size_t result2 = myFunctor.AdditiveHash(reinterpret_cast<const std::uint8_t*>(myName2.c_str()), myName2.size());
-			std::size_t result3 = myFunctor.AdditiveHash(reinterpret_cast<const std::uint8_t*>(myName3.c_str()), myName3.size());
+			std::size_t result = myFunctor.ByteHash(reinterpret_cast<const std::uint8_t*>(myName.c_str()), myName.size());
+			std::size_t result2 = myFunctor.ByteHash(reinterpret_cast<const std::uint8_t*>(myName2.c_str()), myName2.size());
+			std::size_t result3 = myFunctor.ByteHash(reinterpret_cast<const std::uint8_t*>(myName3.c_str()), myName3.size());
 			
 			Assert::AreEqual(result, result2);
 			Assert::AreNotEqual(result, result3);
@@ -79,16 +80,16 @@ namespace LibraryDesktopTests
 			}
 		}
 
-		TEST_METHOD(AdditiveHashCharStar)
+		TEST_METHOD(ByteHashCharStar)
 		{
 			HashFunctor<char*> myFunctor;
 			const char* myName = "Andrew";
 			const char* myName2 = "Andrew";
 			const char* myName3 = "Drew";
 
-			std::size_t result = myFunctor.AdditiveHash(reinterpret_cast<const std::uint8_t*>(myName), strlen(myName));
-			std::size_t result2 = myFunctor.AdditiveHash(reinterpret_cast<const std::uint8_t*>(myName2), strlen(myName2));
-			std::size_t result3 = myFunctor.AdditiveHash(reinterpret_cast<const std::uint8_t*>(myName3), strlen(myName3));
+			std::size_t result = myFunctor.ByteHash(reinterpret_cast<const std::uint8_t*>(myName), strlen(myName));
+			std::size_t result2 = myFunctor.ByteHash(reinterpret_cast<const std::uint8_t*>(myName2), strlen(myName2));
+			std::size_t result3 = myFunctor.ByteHash(reinterpret_cast<const std::uint8_t*>(myName3), strlen(myName3));
 
 			Assert::AreEqual(result, result2);
 			Assert::AreNotEqual(result, result3);
@@ -123,6 +124,81 @@ namespace LibraryDesktopTests
 			}
 		}
 
+		TEST_METHOD(HashFunctorPod)
+		{
+			HashFunctor<std::int32_t> intFunctor;
+			Assert::AreEqual(intFunctor(1), intFunctor(1));
+			Assert::AreNotEqual(intFunctor(1), intFunctor(2));
+			Assert::AreNotEqual(intFunctor(0x0102), intFunctor(0x0201));
+
+			HashFunctor<glm::vec4> vectorFunctor;
+			Assert::AreEqual(vectorFunctor(glm::vec4(1, 2, 3, 4)), vectorFunctor(glm::vec4(1, 2, 3, 4)));
+			Assert::AreNotEqual(vectorFunctor(glm::vec4(1, 2, 3, 4)), vectorFunctor(glm::vec4(4, 3, 2, 1)));
+		}
+
+		TEST_METHOD(Anagrams)
+		{
+			HashFunctor<std::string> myFunctor;
+			Assert::AreNotEqual(myFunctor("Position"s), myFunctor("Positoin"s));
+			Assert::AreNotEqual(myFunctor("ab"s), myFunctor("ba"s));
+			Assert::AreNotEqual(myFunctor("Attribute12"s), myFunctor("Attribute21"s));
+			Assert::AreNotEqual(myFunctor(""s), myFunctor("\0"s));
+
+			std::string longKey(100, 'x');
+			std::string longKey2 = longKey;
+			longKey2[50] = 'y';
+			Assert::AreNotEqual(myFunctor(longKey), myFunctor(longKey2));
+		}
+
+		TEST_METHOD(AttributeNameCollisionStatistics)
+		{
+			// Representative attribute names: "this", the prescribed GameObject attributes and those of the Actions.
+			const Vector<std::string> names{ "this"s, "Name"s, "Position"s, "Rotation"s, "Scale"s, "Children"s, "Actions"s,
+				"Condition"s, "Target"s, "Step"s, "ClassName"s, "InstanceName"s };
+
+			HashFunctor<std::string> myFunctor;
+			Vector<std::size_t> hashes;
+			for (const auto& name : names)
+			{
+				std::size_t hash = myFunctor(name);
+				Assert::IsTrue(hashes.Find(hash) == hashes.end(), L"Full hash collision between attribute names.");
+				hashes.PushBack(hash);
+			}
+
+			// Default Scope bucket count. With uniform hashing the fullest bucket of this many names stays small.
+			const std::size_t bucketCount = 11;
+			Vector<std::size_t> occupancy;
+			occupancy.Resize(bucketCount);
+			for (std::size_t hash : hashes)
+			{
+				++occupancy[hash % bucketCount];
+			}
+
+			std::size_t fullest = 0;
+			for (std::size_t count : occupancy)
+			{
+				fullest = std::max(fullest, count);
+			}
+			Assert::IsTrue(fullest <= 4);
+
+			// Numbered keys, the worst case for the previous additive hash, should fill most buckets evenly.
+			const std::size_t keyCount = 1000;
+			Vector<std::size_t> spread;
+			spread.Resize(keyCount);
+			for (std::size_t i = 0; i < keyCount; ++i)
+			{
+				++spread[myFunctor("Attribute"s + std::to_string(i)) % keyCount];
+			}
+
+			std::size_t emptyBuckets = 0;
+			for (std::size_t count : spread)
+			{
+				emptyBuckets += (count == 0);
+			}
+			// Expected fraction of empty buckets for uniform hashing is 1/e, roughly 368 of 1000.
+			Assert::IsTrue(emptyBuckets > 300 && emptyBuckets < 440);
+		}
+
 	private:
 		static _CrtMemState _startMemState;
 	};
@@ -44,6 +44,29 @@ namespace Microsoft::VisualStudio::CppUnitTestFramework
 	}
 }
 
+namespace
+{
+	/// Hashes and compares strings ignoring ASCII case.
+	struct CaseInsensitiveHash final
+	{
+		std::size_t operator()(const std::string& key) const
+		{
+			std::string lower(key);
+			std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+			return HashFunctor<std::string>{}(lower);
+		}
+	};
+
+	struct CaseInsensitiveEqual final
+	{
+		bool operator()(const std::string& lhs, const std::string& rhs) const
+		{
+			return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin(),
+				[](unsigned char a, unsigned char b) { return std::tolower(a) == std::tolower(b); });
+		}
+	};
+}
+
 namespace LibraryDesktopTests
 {
 	TEST_CLASS(HashmapTests)
@@ -232,27 +255,33 @@ namespace LibraryDesktopTests
 
 			Hashmap<std::string, Foo>::Iterator it1 = myMap.begin();
 			Hashmap<std::string, Foo>::Iterator it2 = myMap.begin();
+			Vector<std::string> visited;
 
 			Assert::AreEqual(*it1, *it2);
-			Assert::AreEqual(pair1, *it1);
+			visited.PushBack((*it1).first);
 
 			++it1;
 			++it2;
 
 			Assert::AreEqual(*it1, *it2);
-			Assert::AreEqual(pair2, *it1);
+			visited.PushBack((*it1).first);
 
 			it1++;
 			it2++;
 
 			Assert::AreEqual(*it1, *it2);
-			Assert::AreEqual(pair3, *it1);			
+			visited.PushBack((*it1).first);			
 
 			++it1;
 			++it2;
 
 			Assert::AreEqual(myMap.end(), it1);
 			Assert::AreEqual(myMap.end(), it2);
+
+			// Visit order depends on the hash; each entry must be seen exactly once.
+			Assert::IsTrue(visited.Find(pair1.first) != visited.end());
+			Assert::IsTrue(visited.Find(pair2.first) != visited.end());
+			Assert::IsTrue(visited.Find(pair3.first) != visited.end());
 		}
 
 		TEST_METHOD(ConstIteratorIncrementOperators)
@@ -270,27 +299,33 @@ namespace LibraryDesktopTests
 
 			Hashmap<std::string, Foo>::ConstIterator it1 = myConstMap.cbegin();
 			Hashmap<std::string, Foo>::ConstIterator it2 = myConstMap.cbegin();
+			Vector<std::string> visited;
 
 			Assert::AreEqual(*it1, *it2);
-			Assert::AreEqual(pair1, *it1);
+			visited.PushBack((*it1).first);
 
 			++it1;
 			++it2;
 
 			Assert::AreEqual(*it1, *it2);
-			Assert::AreEqual(pair2, *it1);
+			visited.PushBack((*it1).first);
 
 			it1++;
 			it2++;
 
 			Assert::AreEqual(*it1, *it2);
-			Assert::AreEqual(pair3, *it1);
+			visited.PushBack((*it1).first);
 
 			++it1;
 			++it2;
 
 			Assert::AreEqual(myConstMap.cend(), it1);
 			Assert::AreEqual(myConstMap.cend(), it2);
+
+			// Visit order depends on the hash; each entry must be seen exactly once.
+			Assert::IsTrue(visited.Find(pair1.first) != visited.end());
+			Assert::IsTrue(visited.Find(pair2.first) != visited.end());
+			Assert::IsTrue(visited.Find(pair3.first) != visited.end());
 		}
 
 		TEST_METHOD(IteratorDereferenceOperators)
@@ -539,6 +574,79 @@ namespace LibraryDesktopTests
 			Assert::AreEqual(float(0.2), myMap.LoadFactor());
 		}
 
+		TEST_METHOD(MaxLoadFactor)
+		{
+			Hashmap<std::string, Foo> myMap(2);
+			Assert::AreEqual(1.0f, myMap.MaxLoadFactor());
+			Assert::ExpectException<std::runtime_error>([&myMap]() { myMap.SetMaxLoadFactor(0.0f); });
+
+			myMap.Insert(std::make_pair("Andrew"s, Foo(1)));
+			myMap.Insert(std::make_pair("Drew"s, Foo(2)));
+			Assert::AreEqual(std::size_t(2), myMap.BucketCount());
+
+			myMap.Insert(std::make_pair("AJ"s, Foo(3)));
+			Assert::IsTrue(myMap.BucketCount() > std::size_t(2));
+			Assert::IsTrue(myMap.LoadFactor() <= myMap.MaxLoadFactor());
+
+			myMap.SetMaxLoadFactor(0.25f);
+			Assert::IsTrue(myMap.BucketCount() >= std::size_t(12));
+			Assert::IsTrue(myMap.LoadFactor() <= myMap.MaxLoadFactor());
+			Assert::AreEqual(Foo(1), myMap.At("Andrew"));
+			Assert::AreEqual(Foo(2), myMap.At("Drew"));
+			Assert::AreEqual(Foo(3), myMap.At("AJ"));
+		}
+
+		TEST_METHOD(Rehash)
+		{
+			Hashmap<std::string, Foo> myMap;
+			Vector<std::pair<const std::string, Foo>*> addresses;
+			for (int i = 0; i < 200; ++i)
+			{
+				auto [it, wasInserted] = myMap.Insert(std::make_pair(std::to_string(i), Foo(i)));
+				Assert::IsTrue(wasInserted);
+				addresses.PushBack(&(*it));
+			}
+			Assert::AreEqual(std::size_t(200), myMap.Size());
+			Assert::IsTrue(myMap.BucketCount() >= std::size_t(200));
+
+			myMap.Rehash(997);
+			Assert::AreEqual(std::size_t(997), myMap.BucketCount());
+			myMap.Rehash(3);
+			Assert::AreEqual(std::size_t(200), myMap.BucketCount());
+
+			std::size_t count = 0;
+			for (auto it = myMap.begin(); it != myMap.end(); ++it)
+			{
+				++count;
+			}
+			Assert::AreEqual(std::size_t(200), count);
+
+			for (int i = 0; i < 200; ++i)
+			{
+				auto it = myMap.Find(std::to_string(i));
+				Assert::IsTrue(it != myMap.end());
+				Assert::IsTrue(addresses[i] == &(*it));
+				Assert::AreEqual(Foo(i), (*it).second);
+			}
+		}
+
+		TEST_METHOD(Reserve)
+		{
+			Hashmap<std::string, Foo> myMap;
+			myMap.Reserve(100);
+			std::size_t bucketCount = myMap.BucketCount();
+			Assert::IsTrue(bucketCount >= std::size_t(100));
+
+			for (int i = 0; i < 100; ++i)
+			{
+				myMap.Insert(std::make_pair(std::to_string(i), Foo(i)));
+			}
+			Assert::AreEqual(bucketCount, myMap.BucketCount());
+
+			myMap.Reserve(10);
+			Assert::AreEqual(bucketCount, myMap.BucketCount());
+		}
+
 		TEST_METHOD(ContainsKey)
 		{
 			{
@@ -616,6 +724,126 @@ namespace LibraryDesktopTests
 			}
 		}
 
+		TEST_METHOD(Policies)
+		{
+			using map_type = Hashmap<std::string, Foo, CaseInsensitiveHash, CaseInsensitiveEqual>;
+			map_type myMap;
+			myMap.Insert(std::make_pair("Health"s, Foo(1)));
+			myMap["MANA"s] = Foo(2);
+
+			Assert::IsTrue(myMap.ContainsKey("health"s));
+			Assert::AreEqual(Foo(2), myMap.At("mana"s));
+			Assert::IsFalse(myMap.Insert(std::make_pair("HEALTH"s, Foo(3))).second);
+			Assert::AreEqual(std::size_t(2), myMap.Size());
+
+			const map_type copy = myMap;
+			Assert::IsTrue(copy.Find("Mana"s) != copy.cend());
+			Assert::IsTrue(myMap.Remove("hEaLtH"s));
+			Assert::AreEqual(std::size_t(1), myMap.Size());
+		}
+
+		TEST_METHOD(NodePool)
+		{
+			Hashmap<std::string, Foo> myMap(5);
+			myMap.Reserve(20);
+			for (int i = 0; i < 20; ++i)
+			{
+				myMap.Insert(std::make_pair(std::to_string(i), Foo(i)));
+			}
+
+			Hashmap<std::string, Foo> copy(myMap);
+			for (int i = 0; i < 20; ++i)
+			{
+				Assert::IsTrue(myMap.Remove(std::to_string(i)));
+			}
+			Assert::AreEqual(std::size_t(0), myMap.Size());
+			Assert::AreEqual(std::size_t(20), copy.Size());
+			for (int i = 0; i < 20; ++i)
+			{
+				Assert::AreEqual(Foo(i), copy.At(std::to_string(i)));
+			}
+
+			myMap = copy;
+			copy.Clear();
+			Assert::AreEqual(std::size_t(20), myMap.Size());
+			Assert::AreEqual(Foo(7), myMap.At("7"));
+		}
+
+		TEST_METHOD(ChurnRecyclesNodes)
+		{
+			// Insert/remove churn on a steady population, as a scope with transient attributes sees.
+			// Once the first round has carved enough nodes, later rounds only recycle them.
+			const int population = 256;
+			using chain_type = SList<std::pair<const int, int>>;
+			auto pool = std::make_shared<chain_type::NodePool>();
+			HashFunctor<int> hash;
+			const std::size_t bucketCount = 31;
+			Vector<chain_type> chains(bucketCount);
+			for (std::size_t i = 0; i < bucketCount; ++i)
+			{
+				chains.PushBack(chain_type(pool));
+			}
+
+			std::size_t capacity = 0;
+			for (int round = 0; round < 5; ++round)
+			{
+				for (int i = 0; i < population; ++i)
+				{
+					chains[hash(i) % bucketCount].PushBack(std::make_pair(i, round));
+				}
+				Assert::AreEqual(pool->Capacity() - std::size_t(population), pool->Available());
+				if (round == 0)
+				{
+					capacity = pool->Capacity();
+				}
+				Assert::AreEqual(capacity, pool->Capacity());
+
+				for (int i = 0; i < population; ++i)
+				{
+					chain_type& chain = chains[hash(i) % bucketCount];
+					for (auto it = chain.begin(); it != chain.end(); ++it)
+					{
+						if ((*it).first == i)
+						{
+							chain.Remove(it);
+							break;
+						}
+					}
+				}
+				Assert::AreEqual(capacity, pool->Available());
+			}
+
+			Hashmap<int, int> myMap(bucketCount);
+			for (int i = 0; i < population; ++i)
+			{
+				myMap.Insert(std::make_pair(i, i));
+			}
+			for (int i = 0; i < population; ++i)
+			{
+				myMap.Remove(i);
+			}
+#if defined(_DEBUG)
+			_CrtMemState before, after;
+			_CrtMemCheckpoint(&before);
+#endif
+			for (int round = 0; round < 5; ++round)
+			{
+				for (int i = 0; i < population; ++i)
+				{
+					myMap.Insert(std::make_pair(i, round));
+				}
+				Assert::AreEqual(std::size_t(population), myMap.Size());
+				for (int i = 0; i < population; ++i)
+				{
+					Assert::IsTrue(myMap.Remove(i));
+				}
+			}
+#if defined(_DEBUG)
+			_CrtMemCheckpoint(&after);
+			Assert::AreEqual(before.lTotalCount, after.lTotalCount);
+#endif
+		}
+
 	private:
 		static _CrtMemState _startMemState;
 	};
@@ -0,0 +1,105 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "JobSystem.h"
+#include <crtdbg.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(JobSystemTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"There was a memory leak.");
+			}
+#endif
+		}
+
+		TEST_METHOD(ParallelFor)
+		{
+			for (std::size_t workerCount : { std::size_t(0), std::size_t(1), std::size_t(3) })
+			{
+				JobSystem jobs(workerCount);
+				Assert::AreEqual(workerCount, jobs.WorkerCount());
+
+				for (std::size_t count : { std::size_t(0), std::size_t(1), std::size_t(7), std::size_t(1000) })
+				{
+					Vector<int> hits(count);
+					hits.Resize(count);
+					std::atomic<std::size_t> calls{ 0 };
+					jobs.ParallelFor(count, [&hits, &calls](std::size_t i)
+					{
+						++hits[i];
+						++calls;
+					});
+
+					Assert::AreEqual(count, calls.load());
+					for (std::size_t i = 0; i < count; ++i)
+					{
+						Assert::AreEqual(1, hits[i]);
+					}
+				}
+			}
+		}
+
+		TEST_METHOD(Nested)
+		{
+			JobSystem jobs(2);
+			const std::size_t outer = 16;
+			const std::size_t inner = 64;
+			std::atomic<std::size_t> total{ 0 };
+			jobs.ParallelFor(outer, [&jobs, &total, inner](std::size_t)
+			{
+				jobs.ParallelFor(inner, [&total](std::size_t i)
+				{
+					total += i;
+				});
+			});
+			Assert::AreEqual(outer * (inner * (inner - 1) / 2), total.load());
+		}
+
+		TEST_METHOD(Exceptions)
+		{
+			JobSystem jobs(2);
+			std::atomic<std::size_t> calls{ 0 };
+			Assert::ExpectException<std::runtime_error>([&jobs, &calls]
+			{
+				jobs.ParallelFor(100, [&calls](std::size_t i)
+				{
+					++calls;
+					if (i == 42)
+					{
+						throw std::runtime_error("Job failed.");
+					}
+				});
+			});
+
+			// The failing chunk stops at index 42, but every other chunk still runs.
+			Assert::IsTrue(calls.load() >= 43);
+			jobs.ParallelFor(10, [&calls](std::size_t) { ++calls; });
+		}
+
+	private:
+		static _CrtMemState _startMemState;
+	};
+
+	_CrtMemState JobSystemTests::_startMemState;
+}
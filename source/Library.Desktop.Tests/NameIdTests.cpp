@@ -0,0 +1,99 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "NameId.h"
+#include "Hashmap.h"
+#include <crtdbg.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(NameIdTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"There was a memory leak.");
+			}
+#endif
+		}
+
+		TEST_METHOD(Constructor)
+		{
+			NameId empty;
+			Assert::IsTrue(empty.IsEmpty());
+			Assert::AreEqual(std::size_t(0), empty.Hash());
+			Assert::AreEqual(std::string(), empty.Name());
+			Assert::IsTrue(NameId(""s) == empty);
+
+			NameId health("NameIdTests.Health"s);
+			Assert::IsFalse(health.IsEmpty());
+			Assert::AreEqual("NameIdTests.Health"s, health.Name());
+			Assert::AreEqual(HashFunctor<std::string>{}("NameIdTests.Health"s), health.Hash());
+
+			NameId fromCharStar("NameIdTests.Health");
+			Assert::IsTrue(health == fromCharStar);
+		}
+
+		TEST_METHOD(Identity)
+		{
+			NameId a("NameIdTests.A"s);
+			NameId alsoA(std::string("NameIdTests.") + "A");
+			NameId b("NameIdTests.B"s);
+
+			Assert::IsTrue(a == alsoA);
+			Assert::IsFalse(a != alsoA);
+			Assert::IsTrue(a != b);
+			Assert::IsTrue(&a.Name() == &alsoA.Name());
+			Assert::AreEqual(a.Hash(), alsoA.Hash());
+
+			Assert::IsTrue(a == "NameIdTests.A"s);
+			Assert::IsTrue(a != "NameIdTests.B"s);
+		}
+
+		TEST_METHOD(Find)
+		{
+			Assert::IsTrue(NameId::Find("NameIdTests.NeverInterned"s).IsEmpty());
+			Assert::IsTrue(NameId::Find("NameIdTests.NeverInterned"s).IsEmpty());
+
+			NameId interned("NameIdTests.Interned"s);
+			NameId found = NameId::Find("NameIdTests.Interned"s);
+			Assert::IsFalse(found.IsEmpty());
+			Assert::IsTrue(interned == found);
+		}
+
+		TEST_METHOD(HashmapKey)
+		{
+			Hashmap<NameId, int> map;
+			NameId x("NameIdTests.X"s);
+			NameId y("NameIdTests.Y"s);
+			map.Insert(std::make_pair(x, 1));
+			map.Insert(std::make_pair(y, 2));
+
+			Assert::AreEqual(1, map.At(NameId("NameIdTests.X"s)));
+			Assert::AreEqual(2, map.At(NameId::Find("NameIdTests.Y"s)));
+			Assert::IsFalse(map.ContainsKey(NameId()));
+		}
+
+	private:
+		static _CrtMemState _startMemState;
+	};
+
+	_CrtMemState NameIdTests::_startMemState;
+}
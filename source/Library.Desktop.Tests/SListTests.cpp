@@ -447,6 +447,29 @@ namespace LibraryDesktopTests
 				auto expression2 = [&myList]() { myList.Back(); };
 				Assert::ExpectException<std::runtime_error>(expression2);
 			}
+
+			{
+				const Foo a{ 10 };
+				const Foo b{ 20 };
+				const Foo c{ 30 };
+
+				SList<Foo> myList;
+				myList.PushBack(a);
+				myList.PushBack(b);
+				myList.PushBack(c);
+
+				myList.Remove(myList.Find(b));
+				Assert::AreEqual(size_t(2), myList.Size());
+				Assert::AreEqual(c, myList.Back());
+
+				myList.Remove(a);
+				Assert::AreEqual(c, myList.Front());
+				Assert::AreEqual(c, myList.Back());
+
+				myList.PushBack(b);
+				Assert::AreEqual(size_t(2), myList.Size());
+				Assert::AreEqual(b, myList.Back());
+			}
 		}
 
 		TEST_METHOD(Constructor)
@@ -753,6 +776,120 @@ namespace LibraryDesktopTests
 			Assert::ExpectException<std::runtime_error>(expression2);
 		}
 
+		TEST_METHOD(TransferFront)
+		{
+			const Foo a{ 10 };
+			const Foo b{ 20 };
+			const Foo c{ 30 };
+
+			SList<Foo> source;
+			SList<Foo> destination;
+			auto expression = [&source, &destination]() { source.TransferFront(destination); };
+			Assert::ExpectException<std::runtime_error>(expression);
+
+			source.PushBack(a);
+			source.PushBack(b);
+			destination.PushBack(c);
+			Foo* address = &source.Front();
+
+			source.TransferFront(destination);
+			Assert::AreEqual(size_t(1), source.Size());
+			Assert::AreEqual(b, source.Front());
+			Assert::AreEqual(size_t(2), destination.Size());
+			Assert::AreEqual(c, destination.Front());
+			Assert::AreEqual(a, destination.Back());
+			Assert::IsTrue(address == &destination.Back());
+
+			source.TransferFront(destination);
+			Assert::IsTrue(source.IsEmpty());
+			Assert::ExpectException<std::runtime_error>([&source]() { source.Back(); });
+			Assert::AreEqual(size_t(3), destination.Size());
+			Assert::AreEqual(b, destination.Back());
+		}
+
+		TEST_METHOD(NodePool)
+		{
+			const Foo a{ 10 };
+			const Foo b{ 20 };
+			const Foo c{ 30 };
+
+			auto pool = std::make_shared<SList<Foo>::NodePool>(2);
+			Assert::AreEqual(size_t(0), pool->Capacity());
+
+			{
+				SList<Foo> list(pool);
+				Assert::IsTrue(list.Pool() == pool);
+				list.PushBack(a);
+				list.PushBack(b);
+				Assert::AreEqual(size_t(2), pool->Capacity());
+				Assert::AreEqual(size_t(0), pool->Available());
+
+				list.PushFront(c);
+				Assert::AreEqual(size_t(6), pool->Capacity());
+				Assert::AreEqual(size_t(3), pool->Available());
+
+				list.PopFront();
+				list.PopBack();
+				Assert::AreEqual(size_t(5), pool->Available());
+
+				for (int i = 0; i < 100; ++i)
+				{
+					list.PushBack(c);
+					list.InsertAfter(list.begin(), b);
+					list.Remove(b);
+					list.PopBack();
+				}
+				Assert::AreEqual(size_t(6), pool->Capacity());
+				Assert::AreEqual(size_t(1), list.Size());
+				Assert::AreEqual(a, list.Front());
+
+				SList<Foo> copy(list);
+				Assert::IsTrue(copy.Pool() == pool);
+				Assert::AreEqual(size_t(2), pool->Capacity() - pool->Available());
+
+				SList<Foo> heapList;
+				heapList.PushBack(b);
+				Assert::IsNull(heapList.Pool().get());
+				Assert::ExpectException<std::runtime_error>([&list, &heapList]() { list.TransferFront(heapList); });
+				Assert::ExpectException<std::runtime_error>([&list, &heapList]() { heapList.TransferFront(list); });
+
+				list.TransferFront(copy);
+				Assert::IsTrue(list.IsEmpty());
+				Assert::AreEqual(size_t(2), copy.Size());
+			}
+			Assert::AreEqual(pool->Capacity(), pool->Available());
+
+			pool->Reserve(50);
+			Assert::IsTrue(pool->Available() >= size_t(50));
+		}
+
+		TEST_METHOD(MoveSemantics)
+		{
+			const Foo a{ 10 };
+			const Foo b{ 20 };
+			auto pool = std::make_shared<SList<Foo>::NodePool>();
+
+			SList<Foo> source(pool);
+			source.PushBack(a);
+			source.PushBack(b);
+			Foo* address = &source.Front();
+
+			SList<Foo> moved(std::move(source));
+			Assert::IsTrue(source.IsEmpty());
+			Assert::AreEqual(size_t(2), moved.Size());
+			Assert::IsTrue(address == &moved.Front());
+			Assert::IsTrue(moved.Pool() == pool);
+
+			SList<Foo> assigned;
+			assigned.PushBack(b);
+			assigned = std::move(moved);
+			Assert::IsTrue(moved.IsEmpty());
+			Assert::AreEqual(size_t(2), assigned.Size());
+			Assert::IsTrue(address == &assigned.Front());
+			Assert::AreEqual(b, assigned.Back());
+			Assert::IsTrue(assigned.Pool() == pool);
+		}
+
 		TEST_METHOD(IsEmpty)
 		{
 			const Foo a{ 10 };
@@ -104,7 +104,8 @@ namespace LibraryDesktopTests
 				Assert::IsTrue(scopeCopy[0] == "bruh"s);
 				Assert::IsTrue(scopeCopy[1] == bDatum);
 				Assert::AreEqual(cScope, scopeCopy[2].GetTable());
-				auto [datum, datumIndex] = scopeCopy.FindContainedScope(cScope);
+				Assert::IsNull(scopeCopy.FindContainedScope(cScope).first);
+				auto [datum, datumIndex] = scopeCopy.FindContainedScope(scopeCopy[2].GetTable());
 				Assert::IsNotNull(datum);
 				Assert::AreEqual(cScope, datum->GetTable());
 				Assert::AreEqual(std::size_t(0), datumIndex);
@@ -124,7 +125,8 @@ namespace LibraryDesktopTests
 				Assert::IsTrue(otherScope[0] == "bruh"s);
 				Assert::IsTrue(otherScope[1] == bDatum);
 				Assert::AreEqual(cScope, otherScope[2].GetTable());
-				auto [datum, datumIndex] = otherScope.FindContainedScope(cScope);
+				Assert::IsNull(otherScope.FindContainedScope(cScope).first);
+				auto [datum, datumIndex] = otherScope.FindContainedScope(otherScope[2].GetTable());
 				Assert::IsNotNull(datum);
 				Assert::AreEqual(cScope, datum->GetTable());
 				Assert::AreEqual(std::size_t(0), datumIndex);
@@ -296,6 +298,39 @@ namespace LibraryDesktopTests
 			}
 		}
 
+		TEST_METHOD(FindByNameId)
+		{
+			const NameId a("A"s);
+			const NameId b("B"s);
+			const NameId unused("ScopeTests.Unused"s);
+
+			Scope scope;
+			Datum& aDatum = scope.Append(a);
+			aDatum = 1;
+			Scope& bScope = scope.AppendScope(b);
+			Assert::AreEqual(std::size_t(2), scope.Size());
+			Assert::IsTrue(&aDatum == scope.Find("A"s));
+			Assert::IsTrue(&aDatum == scope.Find(a));
+			Assert::IsTrue(&aDatum == &scope[a]);
+			Assert::IsNull(scope.Find(unused));
+			Assert::IsNull(scope.Find(NameId()));
+			Assert::IsNull(scope.Find("ScopeTests.NeverInterned"s));
+			Assert::IsTrue(NameId::Find("ScopeTests.NeverInterned"s).IsEmpty());
+
+			Scope* output = nullptr;
+			Assert::IsTrue(&aDatum == bScope.Search(a, output));
+			Assert::IsTrue(&scope == output);
+			Assert::IsNull(bScope.Search(unused));
+			Assert::IsTrue(scope.DownSearch(b).first == &scope);
+
+			const Scope& constScope = scope;
+			Assert::IsTrue(&aDatum == constScope.Find(a));
+			Assert::IsTrue(&aDatum == &constScope[a]);
+			Assert::ExpectException<std::runtime_error>([&constScope, &unused] { constScope[unused]; });
+			Assert::ExpectException<std::runtime_error>([&constScope] { constScope["ScopeTests.NeverInterned"s]; });
+			Assert::ExpectException<std::invalid_argument>([&scope] { scope.Append(NameId()); });
+		}
+
 		TEST_METHOD(Search)
 		{
 			const std::string item = "Item"s;
@@ -328,6 +363,102 @@ namespace LibraryDesktopTests
 			}
 		}
 
+		TEST_METHOD(NameIndex)
+		{
+			Scope root;
+			Assert::IsFalse(root.HasNameIndex());
+			root["Shared"s] = 1;
+			Scope& a = root.AppendScope("A"s);
+			a["Unique"s] = 2;
+			a["Shared"s] = 3;
+			root.EnableNameIndex();
+			root.EnableNameIndex();
+			Assert::IsTrue(a.HasNameIndex());
+			Assert::ExpectException<std::runtime_error>([&a] { a.EnableNameIndex(); });
+
+			// Unique names come straight from the index, shared ones resolve as the scan would.
+			Assert::IsTrue(root.DownSearch("Unique"s) == std::make_pair(&a, std::size_t(0)));
+			Assert::IsTrue(root.DownSearch("Shared"s) == std::make_pair(&root, std::size_t(0)));
+			Assert::IsNull(root.DownSearch("Missing"s).first);
+			Scope& b = a.AppendScope("B"s);
+			b["Deep"s] = 4;
+			Assert::IsTrue(b.HasNameIndex());
+			Assert::IsTrue(b.SearchForTargetContainedDatum("Deep"s) == std::make_pair(&b, std::size_t(0)));
+
+			// Adopting brings names in and drops the adoptee's own index, orphaning takes them out.
+			auto* subtree = new Scope();
+			(*subtree)["Adopted"s] = 5;
+			subtree->AppendScope("Inner"s)["Nested"s] = 6;
+			subtree->EnableNameIndex();
+			b.Adopt(*subtree, "Subtree"s);
+			Assert::AreEqual(6, root.DownSearch("Nested"s).first->Find("Nested"s)->GetInteger());
+			Assert::IsTrue(root.DownSearch("Adopted"s).first == subtree);
+			b.Orphan(*subtree);
+			Assert::IsFalse(subtree->HasNameIndex());
+			Assert::IsNull(root.DownSearch("Adopted"s).first);
+			Assert::IsNull(root.DownSearch("Nested"s).first);
+			delete subtree;
+
+			// Clearing removes the names of the Scope and everything below it.
+			a.Clear();
+			Assert::IsNull(root.DownSearch("Unique"s).first);
+			Assert::IsNull(root.DownSearch("Deep"s).first);
+			Assert::IsTrue(root.DownSearch("Shared"s) == std::make_pair(&root, std::size_t(0)));
+			a["Unique"s] = 7;
+			Assert::IsTrue(root.DownSearch("Unique"s) == std::make_pair(&a, std::size_t(0)));
+
+			// Copies start unindexed, assignment keeps the target's index, moves carry it along.
+			Scope copy(root);
+			Assert::IsFalse(copy.HasNameIndex());
+			Scope assigned;
+			assigned.EnableNameIndex();
+			assigned = root;
+			Assert::IsTrue(assigned.DownSearch("Unique"s).first == &assigned[1].GetTable());
+			Scope moved(std::move(root));
+			Assert::IsTrue(moved.HasNameIndex());
+			Assert::IsTrue(moved.DownSearch("Shared"s) == std::make_pair(&moved, std::size_t(0)));
+			Assert::IsTrue(moved.DownSearch("Unique"s).first == &a);
+			Scope movedChild(std::move(a));
+			Assert::IsFalse(movedChild.HasNameIndex());
+			Assert::IsNull(moved.DownSearch("Unique"s).first);
+			Assert::IsNull(a.GetParent());
+			delete &a;
+			moved.DisableNameIndex();
+			Assert::IsFalse(moved.HasNameIndex());
+			Assert::IsTrue(moved.DownSearch("Shared"s) == std::make_pair(&moved, std::size_t(0)));
+		}
+
+		TEST_METHOD(Members)
+		{
+			Scope scope;
+			Assert::AreEqual(std::size_t(0), scope.Members().size());
+			scope["A"s] = 1;
+			scope.AppendScope("B"s);
+			scope["C"s] = 3;
+			scope["A"s] = 2;
+
+			auto members = scope.Members();
+			Assert::AreEqual(std::size_t(3), members.size());
+			const std::string names[] = { "A"s, "B"s, "C"s };
+			for (std::size_t i = 0; i < members.size(); ++i)
+			{
+				Assert::IsTrue(members[i]._name == names[i]);
+				Assert::IsTrue(members[i]._name == scope.NameAt(i));
+				Assert::IsTrue(members[i]._datum == &scope[i]);
+				Assert::IsTrue(members[i]._datum == scope.Find(names[i]));
+			}
+			Assert::AreEqual(2, members[0]._datum->GetInteger());
+			Assert::ExpectException<std::out_of_range>([&scope] { scope.NameAt(3); });
+
+			// Insertion order survives copies and moves.
+			Scope copy(scope);
+			Scope moved(std::move(copy));
+			Assert::IsTrue(moved.NameAt(2) == "C"s);
+			Assert::AreEqual(3, moved[2].GetInteger());
+			moved.Clear();
+			Assert::AreEqual(std::size_t(0), moved.Members().size());
+		}
+
 		TEST_METHOD(Append)
 		{
 			const std::string a = "A"s;
@@ -340,6 +471,23 @@ namespace LibraryDesktopTests
 			Assert::AreEqual(itemDatum, itemDatum2);
 		}
 
+		TEST_METHOD(AppendGrowsTable)
+		{
+			Scope scope;
+			scope.Reserve(50);
+			for (int i = 0; i < 500; ++i)
+			{
+				scope.Append(std::to_string(i)) = i;
+			}
+			Assert::AreEqual(std::size_t(500), scope.Size());
+
+			for (int i = 0; i < 500; ++i)
+			{
+				Assert::AreEqual(i, scope[i].GetInteger());
+				Assert::AreEqual(&scope[i], scope.Find(std::to_string(i)));
+			}
+		}
+
 		TEST_METHOD(AppendScope)
 		{
 			const std::string a = "A"s;
@@ -492,12 +640,83 @@ namespace LibraryDesktopTests
 			delete &child;
 			Assert::AreEqual(std::size_t(3), scope.Size());
 			Assert::IsNull(scope.FindContainedScope(child).first);
-			//Assert::IsNotNull(scope.FindContainedScope(child2).first);
+			Assert::IsNotNull(scope.FindContainedScope(child2).first);
 			Assert::AreEqual(std::size_t(1), scope[2].Size());
 			scope.Orphan(child2);
 			Assert::AreEqual(std::size_t(3), scope.Size());
 			Assert::IsNotNull(scope.Find(c));
-			//delete &child2Ptr;
+			Assert::IsNull(child2.GetParent());
+			scope.Orphan(child2);
+			delete &child2;
+		}
+
+		TEST_METHOD(OrphanKeepsSiblingSlots)
+		{
+			Scope scope;
+			Vector<Scope*> children;
+			for (int i = 0; i < 5; ++i)
+			{
+				Scope& child = scope.AppendScope("Children"s);
+				child["Id"s] = i;
+				children.PushBack(&child);
+			}
+
+			// Orphaning from the middle shifts later siblings, which must still orphan cleanly.
+			scope.Orphan(*children[1]);
+			scope.Orphan(*children[3]);
+			scope.Orphan(*children[4]);
+			Datum& datum = *scope.Find("Children"s);
+			Assert::AreEqual(std::size_t(2), datum.Size());
+			Assert::AreEqual(0, datum.GetTable(0)["Id"s].GetInteger());
+			Assert::AreEqual(2, datum.GetTable(1)["Id"s].GetInteger());
+			Assert::IsTrue(scope.FindContainedScope(*children[2]) == std::make_pair(&datum, std::size_t(1)));
+
+			// Moved-to Scopes take over the slots of their children.
+			Scope moved(std::move(scope));
+			Assert::IsTrue(children[2]->GetParent() == &moved);
+			moved.Orphan(*children[0]);
+			Assert::AreEqual(2, moved["Children"s].GetTable()["Id"s].GetInteger());
+			Scope assigned;
+			assigned = std::move(moved);
+			Assert::IsTrue(children[2]->GetParent() == &assigned);
+			assigned.Orphan(*children[2]);
+			Assert::AreEqual(std::size_t(0), assigned["Children"s].Size());
+
+			for (Scope* child : children)
+			{
+				delete child;
+			}
+		}
+
+		TEST_METHOD(HierarchyGeneration)
+		{
+			Scope prototype;
+			prototype.AppendScope("Children"s)["Id"s] = 1;
+
+			// Building and copying Scopes attached to nothing leaves the generation alone.
+			std::size_t generation = Scope::HierarchyGeneration();
+			Scope copy(prototype);
+			Scope* clone = prototype.Clone();
+			clone->AppendScope("Children"s);
+			Assert::AreEqual(generation, Scope::HierarchyGeneration());
+
+			// Changing a Scope already in a hierarchy bumps it.
+			Scope root;
+			root.Adopt(*clone, "Children"s);
+			Assert::AreNotEqual(generation, Scope::HierarchyGeneration());
+			generation = Scope::HierarchyGeneration();
+			clone->AppendScope("Children"s);
+			Assert::AreNotEqual(generation, Scope::HierarchyGeneration());
+			generation = Scope::HierarchyGeneration();
+			root.Orphan(*clone);
+			Assert::AreNotEqual(generation, Scope::HierarchyGeneration());
+			generation = Scope::HierarchyGeneration();
+			copy = prototype;
+			Assert::AreNotEqual(generation, Scope::HierarchyGeneration());
+			generation = Scope::HierarchyGeneration();
+			copy.Clear();
+			Assert::AreNotEqual(generation, Scope::HierarchyGeneration());
+			delete clone;
 		}
 
 	private:
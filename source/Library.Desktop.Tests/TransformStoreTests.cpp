@@ -0,0 +1,147 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "TransformStore.h"
+#include "DatumKernels.h"
+#include "GameObject.h"
+#include <crtdbg.h>
+#include "ToStringSpecializations.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(TransformStoreTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"There was a memory leak.");
+			}
+#endif
+		}
+
+		TEST_METHOD(AcquireRelease)
+		{
+			TransformStore store;
+			Assert::AreEqual(std::size_t(0), store.Size());
+			Assert::AreEqual(std::size_t(0), store.PageCount());
+			Assert::ExpectException<std::out_of_range>([&store] { store.Position(0); });
+			Assert::ExpectException<std::out_of_range>([&store] { store.Positions(0); });
+
+			TransformStore::Handle a = store.Acquire();
+			TransformStore::Handle b = store.Acquire();
+			Assert::AreEqual(std::size_t(2), store.Size());
+			Assert::AreEqual(std::size_t(1), store.PageCount());
+			Assert::IsTrue(a != b);
+			Assert::AreEqual(glm::vec4(0), store.Position(b));
+			Assert::AreEqual(glm::vec4(0), store.Scale(b));
+
+			store.Position(a) = glm::vec4(1, 2, 3, 4);
+			store.Release(a);
+			Assert::AreEqual(std::size_t(1), store.Size());
+			Assert::AreEqual(std::size_t(2), store.SlotCount());
+
+			TransformStore::Handle c = store.Acquire();
+			Assert::AreEqual(a, c);
+			Assert::AreEqual(glm::vec4(0), store.Position(c));
+			Assert::AreEqual(std::size_t(2), store.SlotCount());
+			Assert::ExpectException<std::out_of_range>([&store] { store.Release(2); });
+
+			store.Release(b);
+			store.Release(c);
+		}
+
+		TEST_METHOD(StableAddresses)
+		{
+			TransformStore store;
+			Vector<TransformStore::Handle> handles;
+			Vector<glm::vec4*> addresses;
+			for (std::size_t i = 0; i < TransformStore::PageCapacity * 2 + 5; ++i)
+			{
+				handles.PushBack(store.Acquire());
+				addresses.PushBack(&store.Position(handles.Back()));
+			}
+			Assert::AreEqual(std::size_t(3), store.PageCount());
+			Assert::AreEqual(TransformStore::PageCapacity, store.Positions(0).size());
+			Assert::AreEqual(std::size_t(5), store.Rotations(2).size());
+			Assert::ExpectException<std::out_of_range>([&store] { store.Scales(3); });
+
+			for (std::size_t i = 0; i < handles.Size(); i += 2)
+			{
+				store.Release(handles[i]);
+			}
+			for (std::size_t i = 0; i < handles.Size(); ++i)
+			{
+				Assert::IsTrue(addresses[i] == &store.Position(handles[i]));
+			}
+			for (std::size_t i = 0; i < handles.Size(); i += 2)
+			{
+				store.Acquire();
+			}
+			Assert::AreEqual(std::size_t(3), store.PageCount());
+
+			for (TransformStore::Handle handle : handles)
+			{
+				store.Release(handle);
+			}
+		}
+
+		TEST_METHOD(BatchUpdate)
+		{
+			TransformStore store;
+			Vector<GameObject*> gameObjects;
+			for (std::size_t i = 0; i < TransformStore::PageCapacity + 10; ++i)
+			{
+				GameObject* gameObject = new GameObject(store);
+				gameObject->Position() = glm::vec4(static_cast<float>(i), 0, 0, 1);
+				gameObjects.PushBack(gameObject);
+			}
+
+			const glm::vec4 velocity(0, 1, 0, 0);
+			for (std::size_t page = 0; page < store.PageCount(); ++page)
+			{
+				gsl::span<glm::vec4> positions = store.Positions(page);
+				Vector<glm::vec4> offsets(positions.size());
+				for (std::size_t i = 0; i < positions.size(); ++i)
+				{
+					offsets.PushBack(velocity);
+				}
+				DatumKernels::Add(positions, gsl::span<const glm::vec4>(&offsets.Front(), offsets.Size()), positions);
+			}
+
+			for (std::size_t i = 0; i < gameObjects.Size(); ++i)
+			{
+				const glm::vec4 expected(static_cast<float>(i), 1, 0, 1);
+				Assert::AreEqual(expected, gameObjects[i]->Position());
+				Assert::AreEqual(expected, gameObjects[i]->Find("Position"s)->FrontVector());
+			}
+
+			for (GameObject* gameObject : gameObjects)
+			{
+				delete gameObject;
+			}
+			Assert::AreEqual(std::size_t(0), store.Size());
+		}
+
+	private:
+		static _CrtMemState _startMemState;
+	};
+
+	_CrtMemState TransformStoreTests::_startMemState;
+}
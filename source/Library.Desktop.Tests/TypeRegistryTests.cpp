@@ -2,6 +2,8 @@
 #include "CppUnitTest.h"
 #include "AttributedFoo.h"
 #include "TypeRegistry.h"
+#include "ActionListWhile.h"
+#include "ActionIncrement.h"
 #include <crtdbg.h>
 #include "ToStringSpecializations.h"
 
@@ -43,8 +45,35 @@ namespace LibraryDesktopTests
 		TEST_METHOD(GetSignaturesOfType)
 		{
 			TypeRegistry& registry = TypeRegistry::GetInstance();
-			const Vector<Signature>& signatures = registry.GetSignaturesOfType(AttributedFoo::TypeIdClass());
-			Assert::AreEqual("ExternalInteger"s, signatures[0]._name);
+			const Vector<const Signature*>& signatures = registry.GetSignaturesOfType(AttributedFoo::TypeIdClass());
+			Assert::AreEqual("ExternalInteger"s, std::string(signatures[0]->_name));
+			Assert::IsTrue(signatures[0] == AttributedFoo::Signatures().data());
+		}
+
+		TEST_METHOD(InheritedSignatures)
+		{
+			TypeRegistry& registry = TypeRegistry::GetInstance();
+			const Vector<const Signature*>& signatures = registry.GetSignaturesOfType(ActionListWhile::TypeIdClass());
+			Assert::AreEqual(std::size_t(3), signatures.Size());
+			Assert::IsTrue(signatures[0] == Action::Signatures().data());
+			Assert::IsTrue(signatures[1] == ActionList::Signatures().data());
+			Assert::AreEqual("Condition"s, std::string(signatures[2]->_name));
+
+			const Vector<const Signature*>& increment = registry.GetSignaturesOfType(ActionIncrement::TypeIdClass());
+			Assert::AreEqual(std::size_t(3), increment.Size());
+			Assert::IsTrue(increment[0] == signatures[0]);
+			Assert::IsTrue(NameId("Step"s) == registry.GetLayoutOfType(ActionIncrement::TypeIdClass())._names[3]);
+		}
+
+		TEST_METHOD(SignatureOf)
+		{
+			constexpr Signature single = Signature::Of<float>("Single", 8);
+			static_assert(single._type == Datum::DatumType::Float && single._count == 1 && single._offset == 8);
+			constexpr Signature array = Signature::Of<std::string[4]>("Array", 16);
+			static_assert(array._type == Datum::DatumType::String && array._count == 4);
+			constexpr Signature table = Signature::Table("Table", 2);
+			static_assert(table._type == Datum::DatumType::Table && table._count == 2);
+			Assert::AreEqual(std::size_t(16), array._offset);
 		}
 
 	private:
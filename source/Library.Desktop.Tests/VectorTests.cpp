@@ -38,6 +38,52 @@ namespace Microsoft::VisualStudio::CppUnitTestFramework
 	}
 }
 
+namespace
+{
+	/// Counts the blocks handed out, so tests can see when a Vector allocates.
+	struct CountingAllocator final
+	{
+		void* Allocate(std::size_t bytes)
+		{
+			++*allocations;
+			return inner.Allocate(bytes);
+		}
+
+		void* Reallocate(void* memory, std::size_t bytes)
+		{
+			++*allocations;
+			return inner.Reallocate(memory, bytes);
+		}
+
+		void Deallocate(void* memory)
+		{
+			inner.Deallocate(memory);
+		}
+
+		std::size_t* allocations{ nullptr };
+		DefaultAllocator inner;
+	};
+
+	/// Grows by a fixed step of four.
+	struct StepGrowth final
+	{
+		std::size_t operator()(std::size_t, std::size_t capacity) const
+		{
+			return capacity + 4;
+		}
+	};
+
+	/// Move only type that records whether it has been moved from.
+	struct MoveOnly final
+	{
+		explicit MoveOnly(int value) : data(std::make_unique<int>(value)) {}
+		MoveOnly(MoveOnly&&) noexcept = default;
+		MoveOnly& operator=(MoveOnly&&) noexcept = default;
+
+		std::unique_ptr<int> data;
+	};
+}
+
 namespace LibraryDesktopTests
 {
 	TEST_CLASS(VectorTests)
@@ -477,6 +523,14 @@ namespace LibraryDesktopTests
 			Assert::AreEqual(size_t(0), myVector1.Capacity());
 			Assert::AreEqual(size_t(3), myVector2.Capacity());
 
+			myVector2.PushBack(a);
+			myVector1.PushBack(b);
+			Assert::AreEqual(size_t(4), myVector2.Size());
+			Assert::AreEqual(b, myVector1.Front());
+
+			Vector<Foo> myVector3{ a, b };
+			myVector3.PushBack(c);
+			Assert::AreEqual(c, myVector3.Back());
 		}
 
 		TEST_METHOD(AssignmentOperator)
@@ -838,6 +892,131 @@ namespace LibraryDesktopTests
 			Assert::ExpectException<std::runtime_error>(expression2);
 		}
 
+		TEST_METHOD(EmplaceBack)
+		{
+			Vector<std::pair<int, std::string>> myVector;
+			auto& first = myVector.EmplaceBack(1, "one"s);
+			Assert::AreEqual(1, first.first);
+			Assert::AreEqual("one"s, first.second);
+
+			for (int i = 2; i <= 20; ++i)
+			{
+				myVector.EmplaceBack(i, std::to_string(i));
+			}
+			Assert::AreEqual(size_t(20), myVector.Size());
+			Assert::AreEqual("20"s, myVector.Back().second);
+
+			Vector<std::string> strings;
+			strings.PushBack("alias"s);
+			for (std::size_t i = 0; i < 10; ++i)
+			{
+				strings.EmplaceBack(strings.Front());
+			}
+			for (const auto& value : strings)
+			{
+				Assert::AreEqual("alias"s, value);
+			}
+
+			Vector<Foo> foos;
+			foos.PushBack(Foo{ 1 });
+			foos.EmplaceBack(foos[0]);
+			foos.EmplaceBack(foos[1]);
+			Assert::AreEqual(Foo{ 1 }, foos.Back());
+		}
+
+		TEST_METHOD(MoveSemantics)
+		{
+			Vector<MoveOnly> myVector;
+			for (int i = 0; i < 9; ++i)
+			{
+				MoveOnly item(i);
+				myVector.PushBack(std::move(item));
+				Assert::IsTrue(item.data == nullptr);
+			}
+			for (int i = 0; i < 9; ++i)
+			{
+				Assert::AreEqual(i, *myVector[i].data);
+			}
+
+			myVector.Remove(myVector.begin(), myVector.At(3));
+			Assert::AreEqual(size_t(6), myVector.Size());
+			Assert::AreEqual(3, *myVector.Front().data);
+			Assert::AreEqual(8, *myVector.Back().data);
+
+			myVector.ShrinkToFit();
+			Assert::AreEqual(size_t(6), myVector.Capacity());
+			Assert::AreEqual(3, *myVector.Front().data);
+
+			Vector<MoveOnly> other(std::move(myVector));
+			Assert::IsTrue(myVector.IsEmpty());
+			Assert::AreEqual(size_t(6), other.Size());
+		}
+
+		TEST_METHOD(NonTrivialRelocation)
+		{
+			static_assert(!IsTriviallyRelocatable<std::shared_ptr<int>>::value);
+
+			auto shared = std::make_shared<int>(5);
+			{
+				Vector<std::shared_ptr<int>> myVector;
+				for (int i = 0; i < 33; ++i)
+				{
+					myVector.PushBack(shared);
+				}
+				Assert::AreEqual(34L, shared.use_count());
+
+				myVector.Remove(myVector.At(4), myVector.At(10));
+				Assert::AreEqual(28L, shared.use_count());
+
+				myVector.Resize(3);
+				Assert::AreEqual(4L, shared.use_count());
+
+				Vector<std::shared_ptr<int>> copy;
+				copy = myVector;
+				copy = { shared };
+				Assert::AreEqual(5L, shared.use_count());
+			}
+			Assert::AreEqual(1L, shared.use_count());
+		}
+
+		TEST_METHOD(Allocator)
+		{
+			std::size_t allocations = 0;
+			CountingAllocator allocator;
+			allocator.allocations = &allocations;
+
+			Vector<int, IncrementFunctor, CountingAllocator> myVector(0, allocator);
+			for (int i = 0; i < 100; ++i)
+			{
+				myVector.PushBack(i);
+			}
+			Assert::AreEqual(size_t(8), allocations);
+			Assert::AreEqual(size_t(128), myVector.Capacity());
+
+			auto copy = myVector;
+			Assert::AreEqual(size_t(9), allocations);
+			Assert::IsTrue(copy.GetAllocator().allocations == &allocations);
+
+			Vector<int, IncrementFunctor, CountingAllocator> reserved(0, allocator);
+			reserved.Reserve(100);
+			for (int i = 0; i < 100; ++i)
+			{
+				reserved.PushBack(i);
+			}
+			Assert::AreEqual(size_t(10), allocations);
+		}
+
+		TEST_METHOD(GrowthPolicy)
+		{
+			Vector<Foo, StepGrowth> myVector;
+			for (int i = 0; i < 9; ++i)
+			{
+				myVector.PushBack(Foo{ i });
+			}
+			Assert::AreEqual(size_t(12), myVector.Capacity());
+			Assert::AreEqual(Foo{ 8 }, myVector.Back());
+		}
+
 	private:
 		static _CrtMemState _startMemState;
 	};
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "Action.h"
+#include "GameObject.h"
 
 namespace FieaGameEngine
 {
@@ -10,12 +11,28 @@ namespace FieaGameEngine
 	{
 	}
 
-	const Vector<Signature> Action::Signatures()
+	bool Action::IsSubtreeLocal(const Scope& /*subtreeRoot*/)
 	{
-		return Vector<Signature>
+		return false;
+	}
+
+	GameObject* Action::GetGameObject() const
+	{
+		Scope* scope = GetParent();
+		while (scope != nullptr && !scope->Is<GameObject>())
+		{
+			scope = scope->GetParent();
+		}
+		return static_cast<GameObject*>(scope);
+	}
+
+	gsl::span<const Signature> Action::Signatures()
+	{
+		static constexpr Signature signatures[]
 		{
-			{"Name", Datum::DatumType::String, 1, offsetof(Action, _name)}
+			SIGNATURE_OF(Action, _name, "Name")
 		};
+		return signatures;
 	}
 
 	bool Action::Equals(const RTTI* rhs) const 
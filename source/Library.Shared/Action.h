@@ -4,6 +4,8 @@
 
 namespace FieaGameEngine
 {
+	class GameObject;
+
 	/// <summary>
 	/// A component attachable to a GameObject that enables a specific behavior.
 	/// Action is abstract, so must use a concrete derived Action class.
@@ -50,11 +52,23 @@ namespace FieaGameEngine
 		/// <param name="time"></param>
 		virtual void Update(const GameTime& time) = 0;
 
+		/// <summary>
+		/// Returns whether updating this action reads and writes nothing outside the given subtree and
+		/// leaves the structure of the hierarchy alone. GameState only updates a subtree in parallel
+		/// with its siblings when all of its actions say so. Defaults to false, so actions opt in.
+		/// </summary>
+		virtual bool IsSubtreeLocal(const Scope& subtreeRoot);
+
+		/// <summary>
+		/// Returns the nearest GameObject above this action, nullptr if it is not inside one.
+		/// </summary>
+		GameObject* GetGameObject() const;
+
 		/// <summary>
 		/// Returns list of prescribed attributes for this class.
 		/// </summary>
 		/// <returns></returns>
-		static const Vector<Signature> Signatures();
+		static gsl::span<const Signature> Signatures();
 
 		/// <summary>
 		/// Returns whether this class and given Action are equivalent.
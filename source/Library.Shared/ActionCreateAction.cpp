@@ -27,7 +27,20 @@ namespace FieaGameEngine
 		assert(actionPtr != nullptr);
 		actionPtr->SetName(_instanceName);
 
-		parent->Adopt(*actionPtr, "Actions");
+		GameObject* gameObject = GetGameObject();
+		if (gameObject != nullptr)
+		{
+			gameObject->PushOnActionQueue(*parent, *actionPtr);
+		}
+		else
+		{
+			parent->Adopt(*actionPtr, "Actions");
+		}
+	}
+
+	bool ActionCreateAction::IsSubtreeLocal(const Scope& /*subtreeRoot*/)
+	{
+		return GetGameObject() != nullptr;
 	}
 
 	gsl::owner<Attributed*> ActionCreateAction::Clone() const
@@ -35,15 +48,15 @@ namespace FieaGameEngine
 		return new ActionCreateAction();
 	}
 
-	const Vector<Signature> ActionCreateAction::Signatures()
+	gsl::span<const Signature> ActionCreateAction::Signatures()
 	{
-		return Vector<Signature>
+		static constexpr Signature signatures[]
 		{
-			{ "Name", Datum::DatumType::String, 1, offsetof(ActionCreateAction, _name) },
-			{ "ClassName", Datum::DatumType::String, 1, offsetof(ActionCreateAction, _className) },
-			{ "InstanceName", Datum::DatumType::String, 1, offsetof(ActionCreateAction, _instanceName) },
-			{ "Actions", Datum::DatumType::Table, 1, 0 }
+			SIGNATURE_OF(ActionCreateAction, _className, "ClassName"),
+			SIGNATURE_OF(ActionCreateAction, _instanceName, "InstanceName"),
+			Signature::Table("Actions", 1)
 		};
+		return signatures;
 	}
 
 	bool ActionCreateAction::Equals(const RTTI* rhs) const
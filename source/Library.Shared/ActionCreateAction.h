@@ -44,19 +44,25 @@ namespace FieaGameEngine
 		~ActionCreateAction() = default;
 
 		/// <summary>
-		/// Calls update on each Action contained within the list.
+		/// Creates the action and queues it on the owning GameObject, to be adopted at the end of the
+		/// frame. Without an owning GameObject it is adopted immediately.
 		/// </summary>
 		void Update(const GameTime& time) override;
 
+		/// <summary>
+		/// Returns true when owned by a GameObject, since the creation is then only queued.
+		/// </summary>
+		bool IsSubtreeLocal(const Scope& subtreeRoot) override;
+
 		/// <summary>
 		/// Creates a heap allocated copy of this class.
 		/// </summary>
 		virtual gsl::owner<Attributed*> Clone() const override;
 
 		/// <summary>
-		/// Returns list of prescribed attributes for this class.
+		/// Returns the prescribed attributes this class adds to those of its parent.
 		/// </summary>
-		static const Vector<Signature> Signatures();
+		static gsl::span<const Signature> Signatures();
 
 		/// <summary>
 		/// Returns whether this instance and given ActionList instance are equivalent.
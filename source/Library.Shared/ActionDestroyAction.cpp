@@ -33,27 +33,40 @@ namespace FieaGameEngine
 			{
 				assert(action->Is(action->TypeName()));
 
-				action->GetParent()->Orphan(*scope);
-				delete scope;
+				GameObject* gameObject = GetGameObject();
+				if (gameObject != nullptr)
+				{
+					gameObject->PushOnDestroyQueue(*action);
+				}
+				else
+				{
+					action->GetParent()->Orphan(*scope);
+					delete scope;
+				}
 				return;
 			}
 		}
 	}
 
+	bool ActionDestroyAction::IsSubtreeLocal(const Scope& /*subtreeRoot*/)
+	{
+		return GetGameObject() != nullptr;
+	}
+
 	gsl::owner<Attributed*> ActionDestroyAction::Clone() const
 	{
 		return new ActionDestroyAction();
 	}
 
-	const Vector<Signature> ActionDestroyAction::Signatures()
+	gsl::span<const Signature> ActionDestroyAction::Signatures()
 	{
-		return Vector<Signature>
+		static constexpr Signature signatures[]
 		{
-			{ "Name", Datum::DatumType::String, 1, offsetof(ActionDestroyAction, _name) },
-			{ "ClassName", Datum::DatumType::String, 1, offsetof(ActionDestroyAction, _className) },
-			{ "InstanceName", Datum::DatumType::String, 1, offsetof(ActionDestroyAction, _instanceName) },
-			{ "Actions", Datum::DatumType::Table, 1, 0 }
+			SIGNATURE_OF(ActionDestroyAction, _className, "ClassName"),
+			SIGNATURE_OF(ActionDestroyAction, _instanceName, "InstanceName"),
+			Signature::Table("Actions", 1)
 		};
+		return signatures;
 	}
 
 	bool ActionDestroyAction::Equals(const RTTI* rhs) const
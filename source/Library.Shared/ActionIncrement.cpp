@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "ActionIncrement.h"
+#include <algorithm>
 
 namespace FieaGameEngine
 {
@@ -14,26 +15,125 @@ namespace FieaGameEngine
 	{
 		if (_target.empty() == false)
 		{
-			_targetDatum = SearchForTargetDatum(_target);
-			assert(_targetDatum != nullptr);
+			Datum* targetDatum = ResolveTarget();
+			assert(targetDatum != nullptr);
 
-			_targetDatum->SetFloat(_targetDatum->GetFloat() + _step);
+			targetDatum->SetFloat(targetDatum->GetFloat() + _step);
 		}		
 	}
 
+	std::size_t ActionIncrement::UpdateRun(Datum& actions, std::size_t first, const GameTime& /*time*/)
+	{
+		// Increments only write values, so every target resolves as it would one update at a time, and
+		// adding each step to its target's running value in turn gives exactly the sums Update would.
+		struct Group final
+		{
+			Datum* _target;
+			float* _slot;
+			float _value;
+		};
+		Group groups[GroupCount];
+		std::size_t groupCount = 0;
+		Group* current = nullptr;
+		auto flush = [&groups, &groupCount]()
+		{
+			for (std::size_t i = 0; i < groupCount; ++i)
+			{
+				*groups[i]._slot = groups[i]._value;
+			}
+			groupCount = 0;
+		};
+
+		std::size_t index = first;
+		for (; index < actions.Size(); ++index)
+		{
+			ActionIncrement* action = actions.GetTable(index).As<ActionIncrement>();
+			if (action == nullptr)
+			{
+				break;
+			}
+			if (action->_target.empty())
+			{
+				continue;
+			}
+
+			Datum* targetDatum = action->ResolveTarget();
+			assert(targetDatum != nullptr);
+			if (current == nullptr || current->_target != targetDatum)
+			{
+				current = std::find_if(groups, groups + groupCount, [targetDatum](const Group& group) { return group._target == targetDatum; });
+				if (current == groups + groupCount)
+				{
+					// Fail as GetFloat would, keeping the steps already taken.
+					if (targetDatum->Type() != Datum::DatumType::Float)
+					{
+						flush();
+						throw std::runtime_error("Incorrect method overload for datum type.");
+					}
+					if (targetDatum->Size() == 0)
+					{
+						flush();
+						throw std::runtime_error("Index out of bounds.");
+					}
+					if (groupCount == GroupCount)
+					{
+						flush();
+					}
+
+					float* slot = targetDatum->Floats().data();
+					current = &groups[groupCount++];
+					*current = Group{ targetDatum, slot, *slot };
+				}
+			}
+			current->_value += action->_step;
+		}
+		flush();
+		return index;
+	}
+
+	Datum* ActionIncrement::ResolveTarget()
+	{
+		const std::size_t generation = Scope::StructureGeneration();
+		if (_resolvedGeneration != generation || _resolvedTarget != _target)
+		{
+			auto [scope, index] = SearchForTargetContainedDatum(_target);
+			_targetScope = scope;
+			_targetDatum = scope != nullptr ? &(*scope)[index] : nullptr;
+			_resolvedTarget = _target;
+			_resolvedGeneration = generation;
+		}
+		return _targetDatum;
+	}
+
+	bool ActionIncrement::IsSubtreeLocal(const Scope& subtreeRoot)
+	{
+		if (_target.empty())
+		{
+			return true;
+		}
+
+		ResolveTarget();
+		const Scope* scope = _targetScope;
+		while (scope != nullptr && scope != &subtreeRoot)
+		{
+			scope = scope->GetParent();
+		}
+		return scope != nullptr;
+	}
+
 	gsl::owner<Attributed*> ActionIncrement::Clone() const
 	{
 		return new ActionIncrement();
 	}
 
-	const Vector<Signature> ActionIncrement::Signatures()
+	gsl::span<const Signature> ActionIncrement::Signatures()
 	{
-		return Vector<Signature>
+		static constexpr Signature signatures[]
 		{
-			{ "Name", Datum::DatumType::String, 1, offsetof(ActionIncrement, _name) },
-			{ "Target", Datum::DatumType::String, 1, offsetof(ActionIncrement, _target) },
-			{ "Step", Datum::DatumType::Float, 1, offsetof(ActionIncrement, _step)}
+			SIGNATURE_OF(ActionIncrement, _target, "Target"),
+			SIGNATURE_OF(ActionIncrement, _step, "Step")
 		};
+		return signatures;
 	}
 
 	bool ActionIncrement::Equals(const RTTI* rhs) const
@@ -1,10 +1,12 @@
 #pragma once
 #include "Action.h"
+#include <limits>
 
 namespace FieaGameEngine
 {
 	/// <summary>
 	/// Increments a target float value on update by the given step value.
+	/// The resolved target is cached until Scope::StructureGeneration or the target name changes.
 	/// </summary>
 	class ActionIncrement final : public Action
 	{
@@ -47,6 +49,20 @@ namespace FieaGameEngine
 		/// <param name="time"></param>
 		virtual void Update(const GameTime& time) override;
 
+		/// <summary>
+		/// Returns whether the target resolves to an attribute inside given subtree. Resolving it only
+		/// reads names, so increments of different subtrees' own values may run in parallel.
+		/// </summary>
+		bool IsSubtreeLocal(const Scope& subtreeRoot) override;
+
+		/// <summary>
+		/// Updates the run of consecutive ActionIncrements starting at given index of an Actions Datum,
+		/// with the same result as calling Update on each in order, and returns the index after the run.
+		/// Steps are grouped by resolved target and summed into a running value read once through the
+		/// target's float span and written back once, instead of a checked get and set per action.
+		/// </summary>
+		static std::size_t UpdateRun(Datum& actions, std::size_t first, const GameTime& time);
+
 		/// <summary>
 		/// Creates a heap allocated copy of this class.
 		/// </summary>
@@ -54,10 +70,10 @@ namespace FieaGameEngine
 		gsl::owner<Attributed*> Clone() const override;
 
 		/// <summary>
-		/// Returns list of prescribed attributes for this class.
+		/// Returns the prescribed attributes this class adds to those of its parent.
 		/// </summary>
 		/// <returns></returns>
-		static const Vector<Signature> Signatures();
+		static gsl::span<const Signature> Signatures();
 
 		/// <summary>
 		/// Returns whether this class and given ActionIncrement are equivalent.
@@ -85,9 +101,23 @@ namespace FieaGameEngine
 		float Step() const;
 
 	private:
+		/// <summary>
+		/// Returns the Datum the target name resolves to, searching only when the cache is stale.
+		/// </summary>
+		Datum* ResolveTarget();
+
+		/// <summary>
+		/// Most targets UpdateRun holds open at once. Bounded so its groups live on the stack, even on job
+		/// threads; opening one more writes back the open ones first.
+		/// </summary>
+		static constexpr std::size_t GroupCount = 8;
+
 		std::string _target;
 		float _step{ 1.0f };
 		Datum* _targetDatum{ nullptr };
+		Scope* _targetScope{ nullptr };
+		std::string _resolvedTarget;
+		std::size_t _resolvedGeneration{ std::numeric_limits<std::size_t>::max() };
 	};
 
 	ConcreteFactory(ActionIncrement, RTTI)
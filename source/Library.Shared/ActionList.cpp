@@ -1,27 +1,59 @@
 #include "pch.h"
 #include "ActionList.h"
+#include "ActionIncrement.h"
 
 namespace FieaGameEngine
 {
+	namespace
+	{
+		const NameId& ActionsName()
+		{
+			static const NameId name("Actions"s);
+			return name;
+		}
+	}
+
 	RTTI_DEFINITIONS(ActionList)
 
 	ActionList::ActionList() :
-		Action(ActionList::TypeIdClass())
+		Action(ActionList::TypeIdClass()), _actionsIndex(PrescribedAttributeIndex(ActionsName()))
 	{
 	}
 
 	ActionList::ActionList(RTTI::IdType id) :
-		Action(id)
+		Action(id), _actionsIndex(PrescribedAttributeIndex(ActionsName()))
 	{
 	}
 
 	void ActionList::Update(const GameTime& time)
 	{
-		assert(Find("Actions") != nullptr);
-		for (std::size_t i = 0; i < Find("Actions")->Size(); ++i)
+		Datum& actions = Actions();
+		for (std::size_t i = 0; i < actions.Size();)
+		{
+			Action& action = GetAction(i);
+			if (action.Is<ActionIncrement>())
+			{
+				i = ActionIncrement::UpdateRun(actions, i, time);
+			}
+			else
+			{
+				action.Update(time);
+				++i;
+			}
+		}
+	}
+
+	bool ActionList::IsSubtreeLocal(const Scope& subtreeRoot)
+	{
+		Datum& actions = Actions();
+		for (std::size_t i = 0; i < actions.Size(); ++i)
 		{
-			GetAction(i).Update(time);
+			if (!GetAction(i).IsSubtreeLocal(subtreeRoot))
+			{
+				return false;
+			}
 		}
+		return true;
 	}
 
 	Action* ActionList::CreateAction(const std::string& className, const std::string& instanceName)
@@ -32,7 +64,7 @@ namespace FieaGameEngine
 		assert(actionPtr != nullptr);
 
 		actionPtr->SetName(instanceName);
-		Adopt(*actionPtr, "Actions");
+		Adopt(*actionPtr, ActionsName());
 		return actionPtr;
 	}
 
@@ -52,9 +84,7 @@ namespace FieaGameEngine
 
 	Datum& ActionList::Actions()
 	{
-		Datum* actions = Find("Actions");
-		assert(actions != nullptr);
-		return *actions;
+		return PrescribedAttribute(_actionsIndex);
 	}
 
 	gsl::owner<Attributed*> ActionList::Clone() const
@@ -63,13 +93,13 @@ namespace FieaGameEngine
 	}
 
 
-	const Vector<Signature> ActionList::Signatures()
+	gsl::span<const Signature> ActionList::Signatures()
 	{
-		return Vector<Signature>
+		static constexpr Signature signatures[]
 		{
-			{"Name", Datum::DatumType::String, 1, offsetof(ActionList, _name)},
-			{"Actions", Datum::DatumType::Table, 0, 0}
+			Signature::Table("Actions")
 		};
+		return signatures;
 	}
 
 	bool ActionList::Equals(const RTTI* rhs) const
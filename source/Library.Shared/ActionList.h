@@ -54,6 +54,11 @@ namespace FieaGameEngine
 		/// </summary>
 		void Update(const GameTime& time) override;
 
+		/// <summary>
+		/// Returns whether every action in this list is local to given subtree.
+		/// </summary>
+		bool IsSubtreeLocal(const Scope& subtreeRoot) override;
+
 		/// <summary>
 		/// Creates a new action instance within this list.
 		/// </summary>
@@ -74,9 +79,9 @@ namespace FieaGameEngine
 		virtual gsl::owner<Attributed*> Clone() const override;
 
 		/// <summary>
-		/// Returns list of prescribed attributes for this class.
+		/// Returns the prescribed attributes this class adds to those of its parent.
 		/// </summary>
-		static const Vector<Signature> Signatures();
+		static gsl::span<const Signature> Signatures();
 
 		/// <summary>
 		/// Returns whether this instance and given ActionList instance are equivalent.
@@ -87,6 +92,9 @@ namespace FieaGameEngine
 		/// Returns name of this class.
 		/// </summary>
 		std::string ToString() const override;
+
+	private:
+		std::size_t _actionsIndex;
 	};
 
 	ConcreteFactory(ActionList, RTTI)
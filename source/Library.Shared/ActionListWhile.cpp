@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "ActionListWhile.h"
+#include "ActionIncrement.h"
 
 namespace FieaGameEngine
 {
@@ -14,21 +15,30 @@ namespace FieaGameEngine
 	{
 		if (_condition == 1)
 		{
-			for (std::size_t i = 0; i < Find("Actions")->Size(); ++i)
+			Datum& actions = Actions();
+			for (std::size_t i = 0; i < actions.Size();)
 			{
-				GetAction(i).Update(time);
+				Action& action = GetAction(i);
+				if (action.Is<ActionIncrement>())
+				{
+					i = ActionIncrement::UpdateRun(actions, i, time);
+				}
+				else
+				{
+					action.Update(time);
+					++i;
+				}
 			}
 		}
 	}
 
-	const Vector<Signature> ActionListWhile::Signatures()
+	gsl::span<const Signature> ActionListWhile::Signatures()
 	{
-		return Vector<Signature>
+		static constexpr Signature signatures[]
 		{
-			{ "Name", Datum::DatumType::String, 1, offsetof(ActionListWhile, _name) },
-			{ "Condition", Datum::DatumType::Integer, 1, offsetof(ActionListWhile, _condition) },
-			{ "Actions", Datum::DatumType::Table, 0, 0 }
+			SIGNATURE_OF(ActionListWhile, _condition, "Condition")
 		};
+		return signatures;
 	}
 
 	gsl::owner<Attributed*> ActionListWhile::Clone() const
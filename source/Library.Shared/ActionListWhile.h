@@ -44,9 +44,9 @@ namespace FieaGameEngine
 		virtual void Update(const GameTime& time);
 
 		/// <summary>
-		/// Returns the signatures of each data member for this class.
+		/// Returns the prescribed attributes this class adds to those of its parent.
 		/// </summary>
-		static const Vector<Signature> Signatures();
+		static gsl::span<const Signature> Signatures();
 
 		/// <summary>
 		/// Creates a heap allocated copy of this class.
@@ -75,7 +75,7 @@ namespace FieaGameEngine
 		void SetCondition(bool value);
 
 	private:
-		std::uint32_t _condition{ 0 };
+		int _condition{ 0 };
 	};
 
 	ConcreteFactory(ActionListWhile, RTTI)
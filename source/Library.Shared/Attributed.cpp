@@ -6,14 +6,19 @@ namespace FieaGameEngine
 	RTTI_DEFINITIONS(Attributed)
 
 	Attributed::Attributed(RTTI::IdType id) :
-		_id(id)
+		Attributed(id, TypeRegistry::GetInstance().GetType(id))
 	{
-		(*this)["this"s] = this;
-		Populate();
+	}
+
+	Attributed::Attributed(RTTI::IdType id, const TypeRegistry::RegisteredType& type) :
+		Scope(type._layout), _id(id)
+	{
+		(*this)[0] = this;
+		Populate(type._signatures);
 	}
 
 	Attributed::Attributed(const Attributed& other) :
-		Scope(other), _id(other._id)
+		Scope(other), _id(other._id), _prescribedCount(other._prescribedCount)
 	{
 		UpdateExternalStorage();
 	}
@@ -24,14 +29,16 @@ namespace FieaGameEngine
 		{
 			Scope::operator=(other);
 			_id = other._id;
+			_prescribedCount = other._prescribedCount;
 			UpdateExternalStorage();
 		}
 		return *this;
 	}
 
 	Attributed::Attributed(Attributed&& other) noexcept :
-		Scope(std::move(other)), _id(other._id)
+		Scope(std::move(other)), _id(other._id), _prescribedCount(other._prescribedCount)
 	{
+		other._prescribedCount = 0;
 		UpdateExternalStorage();
 	}
 
@@ -41,6 +48,8 @@ namespace FieaGameEngine
 		{
 			Scope::operator=(std::move(other));
 			_id = other._id;
+			_prescribedCount = other._prescribedCount;
+			other._prescribedCount = 0;
 			UpdateExternalStorage();
 		}
 		return *this;
@@ -57,9 +66,7 @@ namespace FieaGameEngine
 
 	bool Attributed::IsPrescribedAttribute(const std::string& name) const
 	{
-		TypeRegistry& registry = TypeRegistry::GetInstance();
-		const Vector<Signature>& signatures = registry.GetSignaturesOfType(_id);
-		return IndexOf(name) <= signatures.Size();
+		return IndexOf(name) <= _prescribedCount;
 	}
 
 	bool Attributed::IsAuxiliaryAttribute(const std::string& name) const
@@ -76,28 +83,57 @@ namespace FieaGameEngine
 		return Append(name);
 	}
 
+	std::size_t Attributed::PrescribedAttributeCount() const
+	{
+		return _prescribedCount;
+	}
+
+	Datum& Attributed::PrescribedAttribute(std::size_t index)
+	{
+		if (index >= _prescribedCount)
+		{
+			throw std::out_of_range("Invalid prescribed attribute index.");
+		}
+		return (*this)[index + 1];
+	}
+
+	const Datum& Attributed::PrescribedAttribute(std::size_t index) const
+	{
+		if (index >= _prescribedCount)
+		{
+			throw std::out_of_range("Invalid prescribed attribute index.");
+		}
+		return (*this)[index + 1];
+	}
+
+	std::size_t Attributed::PrescribedAttributeIndex(NameId name) const
+	{
+		std::size_t index = IndexOf(name);
+		return (index >= 1 && index <= _prescribedCount) ? index - 1 : _prescribedCount;
+	}
+
 	void Attributed::Clear()
 	{
 		Scope::Clear();
 	}
 
-	void Attributed::Populate()
+	void Attributed::Populate(const Vector<const Signature*>& signatures)
 	{
-		TypeRegistry& registry = TypeRegistry::GetInstance();
-		const Vector<Signature>& signatures = registry.GetSignaturesOfType(_id);
-		for (const auto& sig : signatures)
+		_prescribedCount = signatures.Size();
+		for (std::size_t index = 0; index < signatures.Size(); ++index)
 		{
-			Datum& newDatum = Append(sig._name);
-			newDatum.SetType(sig._type);
+			const Signature& sig = *signatures[index];
+			Datum& newDatum = (*this)[index + 1];
 			if (sig._type != Datum::DatumType::Table)
 			{
 				newDatum.SetStorage(sig._type, reinterpret_cast<std::uint8_t*>(this) + sig._offset, sig._count);
 			}
 			else
 			{
+				newDatum.SetType(sig._type);
 				for (std::size_t i = 0; i < sig._count; ++i)
 				{
-					AppendScope(sig._name);
+					AppendScope(NameAt(index + 1));
 				}
 			}
 		}
@@ -107,7 +143,7 @@ namespace FieaGameEngine
 	{
 		(*this)["this"s] = this;
 		TypeRegistry& registry = TypeRegistry::GetInstance();
-		const Vector<Signature>& signatures = registry.GetSignaturesOfType(_id);
+		const Vector<const Signature*>& signatures = registry.GetSignaturesOfType(_id);
 		for (std::size_t i = 0; i < Size(); ++i)
 		{
 			Datum& datum = (*this)[i];
@@ -115,7 +151,7 @@ namespace FieaGameEngine
 			{
 				Datum::DatumType prevType = datum.Type();
 				std::size_t prevSize = datum.Size();
-				datum.SetStorage(prevType, reinterpret_cast<std::uint8_t*>(this) + signatures[i-1]._offset, prevSize);
+				datum.SetStorage(prevType, reinterpret_cast<std::uint8_t*>(this) + signatures[i-1]->_offset, prevSize);
 			}
 		}
 	}
@@ -49,6 +49,30 @@ namespace FieaGameEngine
 		/// </summary>
 		Datum& AppendAuxiliaryAttribute(const std::string& name);
 
+		/// <summary>
+		/// Returns number of prescribed attributes this object was populated with, not counting "this".
+		/// </summary>
+		std::size_t PrescribedAttributeCount() const;
+
+		/// <summary>
+		/// Returns the prescribed attribute at given index, in the order of the type's Signatures.
+		/// Constant time, so derived classes can resolve an index once and skip name lookups.
+		/// Throws if index is out of range.
+		/// </summary>
+		Datum& PrescribedAttribute(std::size_t index);
+
+		/// <summary>
+		/// Returns the prescribed attribute at given index, in the order of the type's Signatures.
+		/// Throws if index is out of range.
+		/// </summary>
+		const Datum& PrescribedAttribute(std::size_t index) const;
+
+		/// <summary>
+		/// Returns index of the prescribed attribute with given name, for use with PrescribedAttribute.
+		/// Returns PrescribedAttributeCount() if the name is not a prescribed attribute.
+		/// </summary>
+		std::size_t PrescribedAttributeIndex(NameId name) const;
+
 		/// <summary>
 		/// Pure virtual clone method so derived classes can create copies of themselves.
 		/// </summary>
@@ -57,7 +81,8 @@ namespace FieaGameEngine
 	protected:
 		/// <summary>
 		/// Default constructor. Takes an ID in order to populate the object with the registered 
-		/// method signatures of the type.
+		/// method signatures of the type. The names come from the layout the type shares, so only
+		/// auxiliary attributes cost this object a map of its own.
 		/// </summary>
 		Attributed(RTTI::IdType id);
 
@@ -77,9 +102,16 @@ namespace FieaGameEngine
 		virtual void Clear() override;
 
 		RTTI::IdType _id;
+		std::size_t _prescribedCount{ 0 };
 
 	private:
-		void Populate();
+		Attributed(RTTI::IdType id, const TypeRegistry::RegisteredType& type);
+
+		/// <summary>
+		/// Stamps the external storage and nested Scopes of each Signature onto the Layout slots.
+		/// Table Signatures without a count only get their type, so they cost nothing until used.
+		/// </summary>
+		void Populate(const Vector<const Signature*>& signatures);
 		void UpdateExternalStorage();
 	};
 }
\ No newline at end of file
@@ -1,11 +1,193 @@
 #include "pch.h"
 #include "Datum.h"
 #include "Scope.h"
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstring>
+#include <type_traits>
 
 using namespace std;
 
 namespace FieaGameEngine
 {
+	namespace
+	{
+		/// <summary>
+		/// Placed in front of heap storage so copies of a Datum can share it. Storage is written only
+		/// while its reference count is one.
+		/// </summary>
+		struct StorageHeader final
+		{
+			std::atomic<std::size_t> _references;
+			bool _isShareable;
+		};
+
+		/// <summary>
+		/// Header size, rounded up so the items that follow stay aligned for every Datum type.
+		/// </summary>
+		constexpr std::size_t HeaderBytes = 16;
+		static_assert(sizeof(StorageHeader) <= HeaderBytes);
+
+		StorageHeader& HeaderOf(void* data)
+		{
+			return *reinterpret_cast<StorageHeader*>(static_cast<std::uint8_t*>(data) - HeaderBytes);
+		}
+
+		void* AllocateHeap(std::size_t bytes)
+		{
+			auto block = static_cast<std::uint8_t*>(malloc(HeaderBytes + bytes));
+			assert(block != nullptr);
+			new (block) StorageHeader{ 1, true };
+			return block + HeaderBytes;
+		}
+
+		void* ReallocateHeap(void* data, std::size_t bytes)
+		{
+			auto block = static_cast<std::uint8_t*>(realloc(static_cast<std::uint8_t*>(data) - HeaderBytes, HeaderBytes + bytes));
+			assert(block != nullptr);
+			return block + HeaderBytes;
+		}
+
+		void FreeHeap(void* data)
+		{
+			free(static_cast<std::uint8_t*>(data) - HeaderBytes);
+		}
+
+		/// <summary>
+		/// Walks a string during parsing. Whitespace is skipped before each token, as sscanf did.
+		/// </summary>
+		class CharReader final
+		{
+		public:
+			explicit CharReader(std::string_view text) :
+				_current(text.data()), _end(text.data() + text.size())
+			{
+			}
+
+			bool TryExpect(std::string_view token)
+			{
+				SkipWhitespace();
+				if (static_cast<std::size_t>(_end - _current) < token.size() || std::string_view(_current, token.size()) != token)
+				{
+					return false;
+				}
+				_current += token.size();
+				return true;
+			}
+
+			void Expect(std::string_view token, const char* error)
+			{
+				if (!TryExpect(token))
+				{
+					throw std::runtime_error(error);
+				}
+			}
+
+			template <typename T>
+			T Read(const char* error)
+			{
+				SkipWhitespace();
+				if (_current != _end && *_current == '+')
+				{
+					++_current;
+				}
+				T value{};
+				auto [next, result] = std::from_chars(_current, _end, value);
+				if (result != std::errc())
+				{
+					throw std::runtime_error(error);
+				}
+				_current = next;
+				return value;
+			}
+
+			template <std::size_t Count>
+			void ReadList(float (&values)[Count], const char* error)
+			{
+				Expect("(", error);
+				for (std::size_t i = 0; i < Count; ++i)
+				{
+					if (i > 0)
+					{
+						Expect(",", error);
+					}
+					values[i] = Read<float>(error);
+				}
+				Expect(")", error);
+			}
+
+		private:
+			void SkipWhitespace()
+			{
+				while (_current != _end && (*_current == ' ' || *_current == '\t' || *_current == '\n' || *_current == '\r'))
+				{
+					++_current;
+				}
+			}
+
+			const char* _current;
+			const char* _end;
+		};
+
+		/// <summary>
+		/// Appends to a fixed buffer during formatting, throwing instead of overrunning it.
+		/// </summary>
+		class CharWriter final
+		{
+		public:
+			explicit CharWriter(gsl::span<char> buffer) :
+				_begin(buffer.data()), _current(buffer.data()), _end(buffer.data() + buffer.size())
+			{
+			}
+
+			void Write(std::string_view text)
+			{
+				if (static_cast<std::size_t>(_end - _current) < text.size())
+				{
+					throw std::runtime_error("Buffer too small for formatted Datum item.");
+				}
+				std::memcpy(_current, text.data(), text.size());
+				_current += text.size();
+			}
+
+			template <typename T>
+			void Write(T value)
+			{
+				auto [next, result] = std::to_chars(_current, _end, value);
+				if (result != std::errc())
+				{
+					throw std::runtime_error("Buffer too small for formatted Datum item.");
+				}
+				_current = next;
+			}
+
+			void WriteList(const glm::vec4& values)
+			{
+				Write("("sv);
+				for (int i = 0; i < 4; ++i)
+				{
+					if (i > 0)
+					{
+						Write(", "sv);
+					}
+					Write(values[i]);
+				}
+				Write(")"sv);
+			}
+
+			std::size_t Length() const
+			{
+				return static_cast<std::size_t>(_current - _begin);
+			}
+
+		private:
+			char* _begin;
+			char* _current;
+			char* _end;
+		};
+	}
+
 	const std::size_t Datum::_datumTypeSizes[]
 	{
 		0,
@@ -41,6 +223,13 @@ namespace FieaGameEngine
 			_size = other._size;
 			_capacity = other._capacity;
 		}
+		else if (other.IsShareable())
+		{
+			HeaderOf(other._dataPtr.vp)._references.fetch_add(1, std::memory_order_relaxed);
+			_dataPtr = other._dataPtr;
+			_size = other._size;
+			_capacity = other._capacity;
+		}
 		else
 		{
 			Reserve(other._capacity);
@@ -85,6 +274,13 @@ namespace FieaGameEngine
 				_size = other._size;
 				_capacity = other._capacity;
 			}
+			else if (!_isExternal && other.IsShareable())
+			{
+				HeaderOf(other._dataPtr.vp)._references.fetch_add(1, std::memory_order_relaxed);
+				_dataPtr = other._dataPtr;
+				_size = other._size;
+				_capacity = other._capacity;
+			}
 			else
 			{
 				Resize(other._capacity);
@@ -167,15 +363,9 @@ namespace FieaGameEngine
 		return GetTable(index);
 	}
 
-	Datum::Datum(Datum&& other) noexcept :
-		_dataPtr(other._dataPtr), _type(other._type), _size(other._size),
-		_capacity(other._capacity), _isExternal(other._isExternal)
+	Datum::Datum(Datum&& other) noexcept
 	{
-		other._dataPtr.vp = nullptr;
-		other._type = DatumType::Unknown;
-		other._size = 0;
-		other._capacity = 0;
-		other._isExternal = false;
+		TakeStorage(other);
 	}
 
 	Datum& Datum::operator=(Datum&& other) noexcept
@@ -184,21 +374,10 @@ namespace FieaGameEngine
 		{
 			if (!_isExternal)
 			{
-				Clear();
-				free(_dataPtr.vp);
+				ReleaseStorage();
 			}
 
-			_dataPtr = other._dataPtr;
-			_type = other._type;
-			_size = other._size;
-			_capacity = other._capacity;
-			_isExternal = other._isExternal;
-
-			other._dataPtr.vp = nullptr;
-			other._type = DatumType::Unknown;
-			other._size = 0;
-			other._capacity = 0;
-			other._isExternal = false;
+			TakeStorage(other);
 		}
 		return *this;
 	}
@@ -207,11 +386,7 @@ namespace FieaGameEngine
 	{
 		if (!_isExternal)
 		{
-			if (_type == DatumType::String)
-			{
-				Clear();
-			}
-			free(_dataPtr.vp);
+			ReleaseStorage();
 		}
 	}
 
@@ -405,12 +580,11 @@ namespace FieaGameEngine
 		}
 		if (size == 0)
 		{
-			Clear();
-			free(_dataPtr.vp);
-			_capacity = 0;
-			_dataPtr.vp = nullptr;
+			ReleaseStorage();
 			return;
 		}
+
+		MakeUnique();
 		if (_type == DatumType::String && size < _size)
 		{
 			for (std::size_t i = size; i < _size; ++i)
@@ -419,9 +593,7 @@ namespace FieaGameEngine
 			}
 		}
 
-		void* data = realloc(_dataPtr.vp, size * _datumTypeSizes[static_cast<int>(_type)]);
-		assert(data != nullptr);
-		_dataPtr.vp = data;
+		Reallocate(size);
 		
 		if (_type == DatumType::String && size > _size)
 		{
@@ -441,6 +613,13 @@ namespace FieaGameEngine
 
 	void Datum::Clear()
 	{
+		if (IsShared())
+		{
+			Detach(_capacity, 0);
+			_size = 0;
+			return;
+		}
+
 		if (_type == DatumType::String)
 		{
 			for (std::size_t i = 0; i < _size; ++i)
@@ -465,13 +644,173 @@ namespace FieaGameEngine
 
 		if (capacity > _capacity)
 		{
-			void* data = realloc(_dataPtr.vp, capacity * _datumTypeSizes[static_cast<int>(_type)]);
-			assert(data != nullptr);
-			_dataPtr.vp = data;
+			Reallocate(capacity);
 			_capacity = capacity;
 		}
 	}
 
+	bool Datum::IsInline() const
+	{
+		return _dataPtr.vp == static_cast<const void*>(_inlineStorage);
+	}
+
+	bool Datum::IsHeap() const
+	{
+		return !_isExternal && _dataPtr.vp != nullptr && !IsInline();
+	}
+
+	bool Datum::IsShared() const
+	{
+		return IsHeap() && HeaderOf(_dataPtr.vp)._references.load(std::memory_order_acquire) > 1;
+	}
+
+	bool Datum::IsShareable() const
+	{
+		return IsHeap() && HeaderOf(_dataPtr.vp)._isShareable;
+	}
+
+	void Datum::MakeUnique()
+	{
+		if (IsShared())
+		{
+			Detach(_capacity, _size);
+		}
+	}
+
+	void Datum::MakeUnshareable()
+	{
+		MakeUnique();
+		if (IsHeap())
+		{
+			HeaderOf(_dataPtr.vp)._isShareable = false;
+		}
+	}
+
+	void Datum::Detach(std::size_t capacity, std::size_t count)
+	{
+		assert(IsHeap() && count <= _size && count <= capacity);
+		void* data = AllocateHeap(capacity * _datumTypeSizes[static_cast<int>(_type)]);
+		CopyItems(data, _dataPtr.vp, count);
+		ReleaseReference(_dataPtr.vp);
+		_dataPtr.vp = data;
+		_capacity = capacity;
+	}
+
+	void Datum::CopyItems(void* destination, const void* source, std::size_t count) const
+	{
+		if (_type == DatumType::String)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				new (static_cast<std::string*>(destination) + i) std::string(static_cast<const std::string*>(source)[i]);
+			}
+		}
+		else if (count > 0)
+		{
+			memcpy(destination, source, count * _datumTypeSizes[static_cast<int>(_type)]);
+		}
+	}
+
+	void Datum::ReleaseReference(void* data)
+	{
+		// Whoever drops the last reference destroys the items, every holder sees the same _size.
+		// Storage that was never shared is the common case, and needs no atomic write: with a count
+		// of one nobody else holds it, so nobody can take a reference while it is released.
+		std::atomic<std::size_t>& references = HeaderOf(data)._references;
+		if (references.load(std::memory_order_acquire) == 1 || references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			if (_type == DatumType::String)
+			{
+				for (std::size_t i = 0; i < _size; ++i)
+				{
+					static_cast<std::string*>(data)[i].~basic_string();
+				}
+			}
+			FreeHeap(data);
+		}
+	}
+
+	void Datum::Reallocate(std::size_t capacity)
+	{
+		assert(!_isExternal && capacity > 0);
+		const std::size_t typeSize = _datumTypeSizes[static_cast<int>(_type)];
+		const std::size_t bytes = capacity * typeSize;
+
+		if (bytes <= InlineCapacityBytes)
+		{
+			if (!IsInline())
+			{
+				if (IsShared())
+				{
+					CopyItems(_inlineStorage, _dataPtr.vp, std::min(_size, capacity));
+					ReleaseReference(_dataPtr.vp);
+				}
+				else if (_dataPtr.vp != nullptr)
+				{
+					memcpy_s(_inlineStorage, InlineCapacityBytes, _dataPtr.vp, std::min(_size, capacity) * typeSize);
+					FreeHeap(_dataPtr.vp);
+				}
+				_dataPtr.vp = _inlineStorage;
+			}
+		}
+		else if (IsInline())
+		{
+			void* data = AllocateHeap(bytes);
+			memcpy_s(data, bytes, _inlineStorage, _size * typeSize);
+			_dataPtr.vp = data;
+		}
+		else if (_dataPtr.vp == nullptr)
+		{
+			_dataPtr.vp = AllocateHeap(bytes);
+		}
+		else if (IsShared())
+		{
+			Detach(capacity, std::min(_size, capacity));
+		}
+		else
+		{
+			_dataPtr.vp = ReallocateHeap(_dataPtr.vp, bytes);
+		}
+	}
+
+	void Datum::ReleaseStorage()
+	{
+		if (IsHeap())
+		{
+			ReleaseReference(_dataPtr.vp);
+		}
+		else if (_type == DatumType::String)
+		{
+			Clear();
+		}
+		_dataPtr.vp = nullptr;
+		_size = 0;
+		_capacity = 0;
+	}
+
+	void Datum::TakeStorage(Datum& other)
+	{
+		_type = other._type;
+		_size = other._size;
+		_capacity = other._capacity;
+		_isExternal = other._isExternal;
+		if (other.IsInline())
+		{
+			memcpy(_inlineStorage, other._inlineStorage, InlineCapacityBytes);
+			_dataPtr.vp = _inlineStorage;
+		}
+		else
+		{
+			_dataPtr = other._dataPtr;
+		}
+
+		other._dataPtr.vp = nullptr;
+		other._type = DatumType::Unknown;
+		other._size = 0;
+		other._capacity = 0;
+		other._isExternal = false;
+	}
+
 	void Datum::SetStorageInteger(int* array, std::size_t size)
 	{
 		SetType(DatumType::Integer);
@@ -479,7 +818,7 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Passed in array is nullptr.");
 		}
-		assert(_capacity == 0);
+		assert(_capacity == 0 || _isExternal);
 		_isExternal = true;
 		_dataPtr.i = array;
 		_size = _capacity = size;
@@ -492,7 +831,7 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Passed in array is nullptr.");
 		}
-		assert(_capacity == 0);
+		assert(_capacity == 0 || _isExternal);
 		_isExternal = true;
 		_dataPtr.f = array;
 		_size = _capacity = size;
@@ -505,7 +844,7 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Passed in array is nullptr.");
 		}
-		assert(_capacity == 0);
+		assert(_capacity == 0 || _isExternal);
 		_isExternal = true;
 		_dataPtr.s = array;
 		_size = _capacity = size;
@@ -518,7 +857,7 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Passed in array is nullptr.");
 		}
-		assert(_capacity == 0);
+		assert(_capacity == 0 || _isExternal);
 		_isExternal = true;
 		_dataPtr.v = array;
 		_size = _capacity = size;
@@ -531,7 +870,7 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Passed in array is nullptr.");
 		}
-		assert(_capacity == 0);
+		assert(_capacity == 0 || _isExternal);
 		_isExternal = true;
 		_dataPtr.m = array;
 		_size = _capacity = size;
@@ -544,7 +883,7 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Passed in array is nullptr.");
 		}
-		assert(_capacity == 0);
+		assert(_capacity == 0 || _isExternal);
 		_isExternal = true;
 		_dataPtr.r = array;
 		_size = _capacity = size;
@@ -557,6 +896,7 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Index out of bounds.");
 		}
+		MakeUnique();
 		_dataPtr.i[index] = value;
 	}
 
@@ -567,6 +907,7 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Index out of bounds.");
 		}
+		MakeUnique();
 		_dataPtr.f[index] = value;
 	}
 
@@ -577,6 +918,7 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Index out of bounds.");
 		}
+		MakeUnique();
 		_dataPtr.s[index] = value;
 	}
 
@@ -587,6 +929,7 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Index out of bounds.");
 		}
+		MakeUnique();
 		_dataPtr.v[index] = value;
 	}
 
@@ -597,6 +940,7 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Index out of bounds.");
 		}
+		MakeUnique();
 		_dataPtr.m[index] = value;
 	}
 
@@ -607,6 +951,7 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Index out of bounds.");
 		}
+		MakeUnique();
 		_dataPtr.r[index] = value;
 	}
 
@@ -617,10 +962,11 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Index out of bounds.");
 		}
+		MakeUnique();
 		_dataPtr.t[index] = &value;
 	}
 
-	void Datum::SetFromString(const std::string& given, std::size_t index)
+	void Datum::SetFromString(std::string_view given, std::size_t index)
 	{
 		switch (_type)
 		{
@@ -634,7 +980,7 @@ namespace FieaGameEngine
 			SetFloat(FromStringToFloat(given), index);
 			break;
 		case FieaGameEngine::Datum::DatumType::String:
-			SetString(given, index);
+			SetString(std::string(given), index);
 			break;
 		case FieaGameEngine::Datum::DatumType::Vector:
 			SetVector(FromStringToVector(given), index);
@@ -648,36 +994,47 @@ namespace FieaGameEngine
 		}
 	}
 
-	int Datum::FromStringToInteger(const std::string& given) const
+	int Datum::FromStringToInteger(std::string_view given) const
 	{
-		int result;
-		sscanf_s(given.c_str(), "%d", &result);
-		return result;
+		return CharReader(given).Read<int>("Could not parse integer from string.");
 	}
 
-	float Datum::FromStringToFloat(const std::string& given) const
+	float Datum::FromStringToFloat(std::string_view given) const
 	{
-		float result;
-		sscanf_s(given.c_str(), "%f", &result);
-		return result;
+		return CharReader(given).Read<float>("Could not parse float from string.");
 	}
 
-	glm::vec4 Datum::FromStringToVector(const std::string& given) const
+	glm::vec4 Datum::FromStringToVector(std::string_view given) const
 	{
-		float x, y, z, w;
-		sscanf_s(given.c_str(), "bvec4(%f, %f, %f, %f)", &x, &y, &z, &w);
-		glm::vec4 result(x, y, z, w);
-		return result;
+		const char* error = "Could not parse vector from string.";
+		CharReader reader(given);
+		reader.Expect("bvec4", error);
+		float values[4];
+		reader.ReadList(values, error);
+		return glm::vec4(values[0], values[1], values[2], values[3]);
 	}
 
-	glm::mat4 Datum::FromStringToMatrix(const std::string& given) const
+	glm::mat4 Datum::FromStringToMatrix(std::string_view given) const
 	{
-		float a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p;
-		sscanf_s(given.c_str(),
-			"mat4x4((%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f))",
-			&a, &b, &c, &d, &e, &f, &g, &h, &i, &j, &k, &l, &m, &n, &o, &p);
-		glm::mat4 result(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p);
-		return result;
+		const char* error = "Could not parse matrix from string.";
+		CharReader reader(given);
+		reader.Expect("mat4x4", error);
+		reader.Expect("(", error);
+		float columns[4][4];
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			if (i > 0)
+			{
+				reader.Expect(",", error);
+			}
+			reader.ReadList(columns[i], error);
+		}
+		reader.Expect(")", error);
+		return glm::mat4(
+			glm::vec4(columns[0][0], columns[0][1], columns[0][2], columns[0][3]),
+			glm::vec4(columns[1][0], columns[1][1], columns[1][2], columns[1][3]),
+			glm::vec4(columns[2][0], columns[2][1], columns[2][2], columns[2][3]),
+			glm::vec4(columns[3][0], columns[3][1], columns[3][2], columns[3][3]));
 	}
 
 	std::string Datum::ToString(std::size_t index) const
@@ -688,31 +1045,17 @@ namespace FieaGameEngine
 			throw std::runtime_error("Cannot make string from Unknown Datum type.");
 			break;
 		case FieaGameEngine::Datum::DatumType::Integer:
-			return std::to_string(GetInteger(index));
-			break;
 		case FieaGameEngine::Datum::DatumType::Float:
-			return std::to_string(GetFloat(index));
+		case FieaGameEngine::Datum::DatumType::Vector:
+		case FieaGameEngine::Datum::DatumType::Matrix:
+			{
+				char buffer[MaxFormattedLength];
+				return std::string(buffer, ToChars(buffer, index));
+			}
 			break;
 		case FieaGameEngine::Datum::DatumType::String:
 			return GetString(index);
 			break;
-		case FieaGameEngine::Datum::DatumType::Vector:
-			glm::vec4 d = GetVector(index);
-			return "bvec4("s + std::to_string(d.x) + ", "s + std::to_string(d.y) +
-				", "s + std::to_string(d.z) + ", "s + std::to_string(d.w) + ")"s;
-			break;
-		case FieaGameEngine::Datum::DatumType::Matrix:
-			glm::mat4 m = GetMatrix(index);
-			return "mat4x4(("s +
-				std::to_string(m[0][0]) + ", "s + std::to_string(m[0][1]) + ", "s +
-				std::to_string(m[0][2]) + ", "s + std::to_string(m[0][3]) + "), ("s +
-				std::to_string(m[1][0]) + ", "s + std::to_string(m[1][1]) + ", "s +
-				std::to_string(m[1][2]) + ", "s + std::to_string(m[1][3]) + "), ("s +
-				std::to_string(m[2][0]) + ", "s + std::to_string(m[2][1]) + ", "s +
-				std::to_string(m[2][2]) + ", "s + std::to_string(m[2][3]) + "), ("s +
-				std::to_string(m[3][0]) + ", "s + std::to_string(m[3][1]) + ", "s +
-				std::to_string(m[3][2]) + ", "s + std::to_string(m[3][3]) + "))"s;
-			break;
 		case FieaGameEngine::Datum::DatumType::Pointer:
 			{ const RTTI* temp = GetPointer(index);
 			if (temp == nullptr)
@@ -731,6 +1074,49 @@ namespace FieaGameEngine
 		}
 	}
 
+	std::size_t Datum::ToChars(gsl::span<char> buffer, std::size_t index) const
+	{
+		CharWriter writer(buffer);
+		switch (_type)
+		{
+		case FieaGameEngine::Datum::DatumType::Unknown:
+			throw std::runtime_error("Cannot make string from Unknown Datum type.");
+			break;
+		case FieaGameEngine::Datum::DatumType::Integer:
+			writer.Write(GetInteger(index));
+			break;
+		case FieaGameEngine::Datum::DatumType::Float:
+			writer.Write(GetFloat(index));
+			break;
+		case FieaGameEngine::Datum::DatumType::String:
+			writer.Write(std::string_view(GetString(index)));
+			break;
+		case FieaGameEngine::Datum::DatumType::Vector:
+			writer.Write("bvec4"sv);
+			writer.WriteList(GetVector(index));
+			break;
+		case FieaGameEngine::Datum::DatumType::Matrix:
+			{
+				const glm::mat4& m = GetMatrix(index);
+				writer.Write("mat4x4("sv);
+				for (int i = 0; i < 4; ++i)
+				{
+					if (i > 0)
+					{
+						writer.Write(", "sv);
+					}
+					writer.WriteList(m[i]);
+				}
+				writer.Write(")"sv);
+			}
+			break;
+		default:
+			writer.Write(std::string_view(ToString(index)));
+			break;
+		}
+		return writer.Length();
+	}
+
 	int Datum::GetInteger(std::size_t index) const
 	{
 		if (_type != DatumType::Integer)
@@ -822,9 +1208,86 @@ namespace FieaGameEngine
 		return *_dataPtr.t[index];
 	}
 
+	template <typename T>
+	gsl::span<T> Datum::Items(DatumType type) const
+	{
+		if (_type != type)
+		{
+			throw std::runtime_error("Incorrect method overload for datum type.");
+		}
+		return gsl::span<T>(static_cast<T*>(_dataPtr.vp), _size);
+	}
+
+	gsl::span<int> Datum::Integers()
+	{
+		MakeUnshareable();
+		return Items<int>(DatumType::Integer);
+	}
+
+	gsl::span<const int> Datum::Integers() const
+	{
+		return Items<int>(DatumType::Integer);
+	}
+
+	gsl::span<float> Datum::Floats()
+	{
+		MakeUnshareable();
+		return Items<float>(DatumType::Float);
+	}
+
+	gsl::span<const float> Datum::Floats() const
+	{
+		return Items<float>(DatumType::Float);
+	}
+
+	gsl::span<std::string> Datum::Strings()
+	{
+		MakeUnshareable();
+		return Items<std::string>(DatumType::String);
+	}
+
+	gsl::span<const std::string> Datum::Strings() const
+	{
+		return Items<std::string>(DatumType::String);
+	}
+
+	gsl::span<glm::vec4> Datum::Vectors()
+	{
+		MakeUnshareable();
+		return Items<glm::vec4>(DatumType::Vector);
+	}
+
+	gsl::span<const glm::vec4> Datum::Vectors() const
+	{
+		return Items<glm::vec4>(DatumType::Vector);
+	}
+
+	gsl::span<glm::mat4> Datum::Matrices()
+	{
+		MakeUnshareable();
+		return Items<glm::mat4>(DatumType::Matrix);
+	}
+
+	gsl::span<const glm::mat4> Datum::Matrices() const
+	{
+		return Items<glm::mat4>(DatumType::Matrix);
+	}
+
+	gsl::span<RTTI*> Datum::Pointers()
+	{
+		MakeUnshareable();
+		return Items<RTTI*>(DatumType::Pointer);
+	}
+
+	gsl::span<RTTI* const> Datum::Pointers() const
+	{
+		return Items<RTTI*>(DatumType::Pointer);
+	}
+
 	void Datum::PushBackInteger(int value)
 	{
 		SetType(DatumType::Integer);
+		MakeUnique();
 		Reserve(_size + 1);
 		++_size;
 		_dataPtr.i[_size - 1] = value;
@@ -833,6 +1296,7 @@ namespace FieaGameEngine
 	void Datum::PushBackFloat(float value)
 	{
 		SetType(DatumType::Float);
+		MakeUnique();
 		Reserve(_size + 1);
 		++_size;
 		_dataPtr.f[_size - 1] = value;
@@ -841,6 +1305,7 @@ namespace FieaGameEngine
 	void Datum::PushBackString(const std::string& value)
 	{
 		SetType(DatumType::String);
+		MakeUnique();
 		Reserve(_size + 1);
 		++_size;
 		new (_dataPtr.s + _size - 1) std::string(value);
@@ -849,6 +1314,7 @@ namespace FieaGameEngine
 	void Datum::PushBackVector(const glm::vec4& value)
 	{
 		SetType(DatumType::Vector);
+		MakeUnique();
 		Reserve(_size + 1);
 		++_size;
 		_dataPtr.v[_size - 1] = value;
@@ -857,6 +1323,7 @@ namespace FieaGameEngine
 	void Datum::PushBackMatrix(const glm::mat4& value)
 	{
 		SetType(DatumType::Matrix);
+		MakeUnique();
 		Reserve(_size + 1);
 		++_size;
 		_dataPtr.m[_size - 1] = value;
@@ -865,20 +1332,168 @@ namespace FieaGameEngine
 	void Datum::PushBackPointer(RTTI* const value)
 	{
 		SetType(DatumType::Pointer);
+		MakeUnique();
 		Reserve(_size + 1);
 		++_size;
 		_dataPtr.r[_size - 1] = value;
 	}
 
+	template <typename T>
+	void Datum::PushBackRange(DatumType type, gsl::span<T const> values)
+	{
+		SetType(type);
+		if (values.empty())
+		{
+			return;
+		}
+
+		// Detaching first leaves a source in the shared storage alive, held by the other owners.
+		MakeUnique();
+		const T* source = values.data();
+		const T* data = static_cast<const T*>(_dataPtr.vp);
+		const bool aliased = !_isExternal && std::less_equal<const T*>{}(data, source) && std::less<const T*>{}(source, data + _size);
+		const std::size_t offset = aliased ? static_cast<std::size_t>(source - data) : 0;
+
+		Reserve(_size + values.size());
+		T* destination = static_cast<T*>(_dataPtr.vp) + _size;
+		if (aliased)
+		{
+			source = static_cast<const T*>(_dataPtr.vp) + offset;
+		}
+
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			memcpy(destination, source, values.size() * sizeof(T));
+		}
+		else
+		{
+			for (std::size_t i = 0; i < values.size(); ++i)
+			{
+				new (destination + i) T(source[i]);
+			}
+		}
+		_size += values.size();
+	}
+
+	template <typename T>
+	void Datum::AssignRange(DatumType type, gsl::span<T const> values)
+	{
+		SetType(type);
+		MakeUnique();
+		T* data = static_cast<T*>(_dataPtr.vp);
+		const std::size_t count = values.size();
+
+		if (_isExternal)
+		{
+			if (count != _size)
+			{
+				throw std::runtime_error("Cannot resize external data.");
+			}
+			if (values.data() != data)
+			{
+				std::copy(values.begin(), values.end(), data);
+			}
+			return;
+		}
+
+		const T* source = values.data();
+		const bool aliased = std::less_equal<const T*>{}(data, source) && std::less<const T*>{}(source, data + _size);
+		if (!aliased)
+		{
+			Clear();
+			PushBackRange(type, values);
+			return;
+		}
+
+		// The range already lives in this Datum, so slide it to the front and drop the rest.
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			memmove(data, source, count * sizeof(T));
+		}
+		else
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				data[i] = source[i];
+			}
+			for (std::size_t i = count; i < _size; ++i)
+			{
+				data[i].~T();
+			}
+		}
+		_size = count;
+	}
+
+	void Datum::PushBackRange(gsl::span<const int> values)
+	{
+		PushBackRange<int>(DatumType::Integer, values);
+	}
+
+	void Datum::PushBackRange(gsl::span<const float> values)
+	{
+		PushBackRange<float>(DatumType::Float, values);
+	}
+
+	void Datum::PushBackRange(gsl::span<const std::string> values)
+	{
+		PushBackRange<std::string>(DatumType::String, values);
+	}
+
+	void Datum::PushBackRange(gsl::span<const glm::vec4> values)
+	{
+		PushBackRange<glm::vec4>(DatumType::Vector, values);
+	}
+
+	void Datum::PushBackRange(gsl::span<const glm::mat4> values)
+	{
+		PushBackRange<glm::mat4>(DatumType::Matrix, values);
+	}
+
+	void Datum::PushBackRange(gsl::span<RTTI* const> values)
+	{
+		PushBackRange<RTTI*>(DatumType::Pointer, values);
+	}
+
+	void Datum::AssignRange(gsl::span<const int> values)
+	{
+		AssignRange<int>(DatumType::Integer, values);
+	}
+
+	void Datum::AssignRange(gsl::span<const float> values)
+	{
+		AssignRange<float>(DatumType::Float, values);
+	}
+
+	void Datum::AssignRange(gsl::span<const std::string> values)
+	{
+		AssignRange<std::string>(DatumType::String, values);
+	}
+
+	void Datum::AssignRange(gsl::span<const glm::vec4> values)
+	{
+		AssignRange<glm::vec4>(DatumType::Vector, values);
+	}
+
+	void Datum::AssignRange(gsl::span<const glm::mat4> values)
+	{
+		AssignRange<glm::mat4>(DatumType::Matrix, values);
+	}
+
+	void Datum::AssignRange(gsl::span<RTTI* const> values)
+	{
+		AssignRange<RTTI*>(DatumType::Pointer, values);
+	}
+
 	void Datum::PushBackTable(Scope& value)
 	{
 		SetType(DatumType::Table);
+		MakeUnique();
 		Reserve(_size + 1);
 		++_size;
 		_dataPtr.t[_size - 1] = &value;
 	}
 
-	void Datum::PushBackFromString(std::string given)
+	void Datum::PushBackFromString(std::string_view given)
 	{
 		switch (_type)
 		{
@@ -892,7 +1507,7 @@ namespace FieaGameEngine
 			PushBackFloat(FromStringToFloat(given));
 			break;
 		case FieaGameEngine::Datum::DatumType::String:
-			PushBackString(given);
+			PushBackString(std::string(given));
 			break;
 		case FieaGameEngine::Datum::DatumType::Vector:
 			PushBackVector(FromStringToVector(given));
@@ -921,6 +1536,7 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot access empty list.");
 		}
+		MakeUnshareable();
 		return _dataPtr.i[0];
 	}
 
@@ -934,6 +1550,7 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot access empty list.");
 		}
+		MakeUnshareable();
 		return _dataPtr.f[0];
 	}
 
@@ -947,6 +1564,7 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot access empty list.");
 		}
+		MakeUnshareable();
 		return _dataPtr.s[0];
 	}
 
@@ -960,6 +1578,7 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot access empty list.");
 		}
+		MakeUnshareable();
 		return _dataPtr.v[0];
 	}
 
@@ -973,6 +1592,7 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot access empty list.");
 		}
+		MakeUnshareable();
 		return _dataPtr.m[0];
 	}
 
@@ -986,6 +1606,7 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot access empty list.");
 		}
+		MakeUnshareable();
 		return _dataPtr.r[0];
 	}
 
@@ -1077,6 +1698,7 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot access empty list.");
 		}
+		MakeUnshareable();
 		return _dataPtr.i[_size - 1];
 	}
 
@@ -1090,6 +1712,7 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot access empty list.");
 		}
+		MakeUnshareable();
 		return _dataPtr.f[_size - 1];
 	}
 
@@ -1103,6 +1726,7 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot access empty list.");
 		}
+		MakeUnshareable();
 		return _dataPtr.s[_size - 1];
 	}
 
@@ -1116,6 +1740,7 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot access empty list.");
 		}
+		MakeUnshareable();
 		return _dataPtr.v[_size - 1];
 	}
 
@@ -1129,6 +1754,7 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot access empty list.");
 		}
+		MakeUnshareable();
 		return _dataPtr.m[_size - 1];
 	}
 
@@ -1142,6 +1768,7 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot access empty list.");
 		}
+		MakeUnshareable();
 		return _dataPtr.r[_size - 1];
 	}
 
@@ -1329,6 +1956,7 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Index out of bounds.");
 		}
+		MakeUnique();
 		if (_type == DatumType::String)
 		{
 			_dataPtr.s[index].~basic_string();
@@ -1496,6 +2124,10 @@ namespace FieaGameEngine
 		//	throw std::runtime_error("Array must have size > 0.");
 		//}
 		//assert(_capacity == 0);
+		if (!_isExternal)
+		{
+			ReleaseStorage();
+		}
 		_isExternal = true;
 		_dataPtr.vp = array;
 		_size = _capacity = size;
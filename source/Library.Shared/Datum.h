@@ -1,7 +1,9 @@
 #pragma once
 #include <cassert>
 #include <stdexcept>
+#include <string_view>
 #include <glm\glm.hpp>
+#include <gsl/gsl>
 #include "RTTI.h"
 #include "Hashmap.h"
 
@@ -12,6 +14,11 @@ namespace FieaGameEngine
 	/// <summary>
 	/// Datum stores a runtime determined type, and has adjustable size.
 	/// Datum can also hold an external array as a shell container.
+	/// Copies share heap storage until one of them writes, so copying a Scope does not duplicate
+	/// the payloads of its internally stored arrays up front. Inline and external storage, such as
+	/// prescribed attributes bound to members, are copied as before. Handing out a mutable span or
+	/// reference makes the storage private to this Datum for good, since writes through it cannot
+	/// be seen.
 	/// </summary>
 	class Datum final
 	{
@@ -287,33 +294,47 @@ namespace FieaGameEngine
 		/// Sets item at given index equal to value parsed from given string.
 		/// Parsed type will be decided from Datum's current type.
 		/// </summary>
-		void SetFromString(const std::string& given, std::size_t index = 0);
+		void SetFromString(std::string_view given, std::size_t index = 0);
 
 		/// <summary>
-		/// Converts string to int.
+		/// Converts string to int. Leading whitespace is skipped. Throws if no number is found.
 		/// </summary>
-		int FromStringToInteger(const std::string& given) const;
+		int FromStringToInteger(std::string_view given) const;
 
 		/// <summary>
-		/// Converts string to float.
+		/// Converts string to float. Leading whitespace is skipped. Throws if no number is found.
 		/// </summary>
-		float FromStringToFloat(const std::string& given) const;
+		float FromStringToFloat(std::string_view given) const;
 
 		/// <summary>
-		/// Converts string to vector.
+		/// Converts string of the form "bvec4(x, y, z, w)" to vector. Throws if malformed.
 		/// </summary>
-		glm::vec4 FromStringToVector(const std::string& given) const;
+		glm::vec4 FromStringToVector(std::string_view given) const;
 
 		/// <summary>
-		/// Converts string to matrix.
+		/// Converts string of the form "mat4x4((a, b, c, d), ...)" to matrix, one group per column.
+		/// Throws if malformed.
 		/// </summary>
-		glm::mat4 FromStringToMatrix(const std::string& given) const;
+		glm::mat4 FromStringToMatrix(std::string_view given) const;
 
 		/// <summary>
-		/// Returns item at given index as a string.
+		/// Returns item at given index as a string. Numbers are formatted as by ToChars.
 		/// </summary>
 		std::string ToString(std::size_t index = 0) const;
 
+		/// <summary>
+		/// Writes item at given index into given buffer without allocating, and returns the number of
+		/// characters written. No terminator is added. Floats use the shortest form that parses back to
+		/// the same value. Throws if the buffer is too small; MaxFormattedLength always suffices for
+		/// numbers, vectors and matrices.
+		/// </summary>
+		std::size_t ToChars(gsl::span<char> buffer, std::size_t index = 0) const;
+
+		/// <summary>
+		/// Buffer length that holds any formatted integer, float, vector or matrix.
+		/// </summary>
+		inline static constexpr std::size_t MaxFormattedLength = 320;
+
 		/// <summary>
 		/// Returns value at given index.
 		/// </summary>
@@ -349,6 +370,72 @@ namespace FieaGameEngine
 		/// </summary>
 		Scope& GetTable(std::size_t index = 0) const;
 
+		/// <summary>
+		/// Returns a view over every item. Throws if the Datum holds a different type.
+		/// The view is invalidated by anything that changes the Datum's capacity.
+		/// </summary>
+		gsl::span<int> Integers();
+
+		/// <summary>
+		/// Returns a view over every item. Throws if the Datum holds a different type.
+		/// </summary>
+		gsl::span<const int> Integers() const;
+
+		/// <summary>
+		/// Returns a view over every item. Throws if the Datum holds a different type.
+		/// The view is invalidated by anything that changes the Datum's capacity.
+		/// </summary>
+		gsl::span<float> Floats();
+
+		/// <summary>
+		/// Returns a view over every item. Throws if the Datum holds a different type.
+		/// </summary>
+		gsl::span<const float> Floats() const;
+
+		/// <summary>
+		/// Returns a view over every item. Throws if the Datum holds a different type.
+		/// The view is invalidated by anything that changes the Datum's capacity.
+		/// </summary>
+		gsl::span<std::string> Strings();
+
+		/// <summary>
+		/// Returns a view over every item. Throws if the Datum holds a different type.
+		/// </summary>
+		gsl::span<const std::string> Strings() const;
+
+		/// <summary>
+		/// Returns a view over every item. Throws if the Datum holds a different type.
+		/// The view is invalidated by anything that changes the Datum's capacity.
+		/// </summary>
+		gsl::span<glm::vec4> Vectors();
+
+		/// <summary>
+		/// Returns a view over every item. Throws if the Datum holds a different type.
+		/// </summary>
+		gsl::span<const glm::vec4> Vectors() const;
+
+		/// <summary>
+		/// Returns a view over every item. Throws if the Datum holds a different type.
+		/// The view is invalidated by anything that changes the Datum's capacity.
+		/// </summary>
+		gsl::span<glm::mat4> Matrices();
+
+		/// <summary>
+		/// Returns a view over every item. Throws if the Datum holds a different type.
+		/// </summary>
+		gsl::span<const glm::mat4> Matrices() const;
+
+		/// <summary>
+		/// Returns a view over every item. Throws if the Datum holds a different type.
+		/// The view is invalidated by anything that changes the Datum's capacity.
+		/// </summary>
+		gsl::span<RTTI*> Pointers();
+
+		/// <summary>
+		/// Returns a view over every item. Throws if the Datum holds a different type.
+		/// </summary>
+		gsl::span<RTTI* const> Pointers() const;
+
 		/// <summary>
 		/// Adds given item to back of Datum.
 		/// </summary>
@@ -379,11 +466,83 @@ namespace FieaGameEngine
 		/// </summary>
 		void PushBackPointer(RTTI* const);
 
+		/// <summary>
+		/// Adds copies of the given items to back of Datum with a single reserve.
+		/// Given items may come from this Datum.
+		/// </summary>
+		void PushBackRange(gsl::span<const int> values);
+
+		/// <summary>
+		/// Adds copies of the given items to back of Datum with a single reserve.
+		/// Given items may come from this Datum.
+		/// </summary>
+		void PushBackRange(gsl::span<const float> values);
+
+		/// <summary>
+		/// Adds copies of the given items to back of Datum with a single reserve.
+		/// Given items may come from this Datum.
+		/// </summary>
+		void PushBackRange(gsl::span<const std::string> values);
+
+		/// <summary>
+		/// Adds copies of the given items to back of Datum with a single reserve.
+		/// Given items may come from this Datum.
+		/// </summary>
+		void PushBackRange(gsl::span<const glm::vec4> values);
+
+		/// <summary>
+		/// Adds copies of the given items to back of Datum with a single reserve.
+		/// Given items may come from this Datum.
+		/// </summary>
+		void PushBackRange(gsl::span<const glm::mat4> values);
+
+		/// <summary>
+		/// Adds copies of the given items to back of Datum with a single reserve.
+		/// Given items may come from this Datum.
+		/// </summary>
+		void PushBackRange(gsl::span<RTTI* const> values);
+
+		/// <summary>
+		/// Replaces the Datum's items with copies of the given items. External storage is written
+		/// in place and must already have the given number of items. Given items may come from this Datum.
+		/// </summary>
+		void AssignRange(gsl::span<const int> values);
+
+		/// <summary>
+		/// Replaces the Datum's items with copies of the given items. External storage is written
+		/// in place and must already have the given number of items. Given items may come from this Datum.
+		/// </summary>
+		void AssignRange(gsl::span<const float> values);
+
+		/// <summary>
+		/// Replaces the Datum's items with copies of the given items. External storage is written
+		/// in place and must already have the given number of items. Given items may come from this Datum.
+		/// </summary>
+		void AssignRange(gsl::span<const std::string> values);
+
+		/// <summary>
+		/// Replaces the Datum's items with copies of the given items. External storage is written
+		/// in place and must already have the given number of items. Given items may come from this Datum.
+		/// </summary>
+		void AssignRange(gsl::span<const glm::vec4> values);
+
+		/// <summary>
+		/// Replaces the Datum's items with copies of the given items. External storage is written
+		/// in place and must already have the given number of items. Given items may come from this Datum.
+		/// </summary>
+		void AssignRange(gsl::span<const glm::mat4> values);
+
+		/// <summary>
+		/// Replaces the Datum's items with copies of the given items. External storage is written
+		/// in place and must already have the given number of items. Given items may come from this Datum.
+		/// </summary>
+		void AssignRange(gsl::span<RTTI* const> values);
+
 		/// <summary>
 		/// Adds item parsed from given string to back of Datum.
 		/// Type parsed depends on Datum's current type.
 		/// </summary>
-		void PushBackFromString(std::string given);
+		void PushBackFromString(std::string_view given);
 
 		/// <summary>
 		/// Removes last item in Datum.
@@ -597,10 +756,39 @@ namespace FieaGameEngine
 		};
 		static const std::size_t _datumTypeSizes[static_cast<std::size_t>(DatumType::End)];
 
+		/// <summary>
+		/// Bytes of storage held inside the Datum itself. Storage that fits, such as a single vec4 or a few
+		/// scalars, is kept here instead of on the heap. _dataPtr points here whenever it is in use.
+		/// </summary>
+		inline static constexpr std::size_t InlineCapacityBytes = sizeof(glm::vec4);
+
+		bool IsInline() const;
+		bool IsHeap() const;
+		bool IsShared() const;
+		bool IsShareable() const;
+		void MakeUnique();
+		void MakeUnshareable();
+		void Detach(std::size_t capacity, std::size_t count);
+		void CopyItems(void* destination, const void* source, std::size_t count) const;
+		void ReleaseReference(void* data);
+		void Reallocate(std::size_t capacity);
+		void ReleaseStorage();
+		void TakeStorage(Datum& other);
+
+		template <typename T>
+		gsl::span<T> Items(DatumType type) const;
+
+		template <typename T>
+		void PushBackRange(DatumType type, gsl::span<T const> values);
+
+		template <typename T>
+		void AssignRange(DatumType type, gsl::span<T const> values);
+
 		DatumValue _dataPtr{ nullptr };
-		DatumType _type{ DatumType::Unknown };
 		std::size_t _size{ 0 };
 		std::size_t _capacity{ 0 };
+		DatumType _type{ DatumType::Unknown };
 		bool _isExternal = false;
+		alignas(glm::vec4) alignas(std::string) alignas(void*) std::uint8_t _inlineStorage[InlineCapacityBytes];
 	};
 }
\ No newline at end of file
@@ -0,0 +1,251 @@
+#include "pch.h"
+#include "DatumKernels.h"
+
+#if !defined(FIEA_KERNELS_SCALAR) && (defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define FIEA_KERNELS_SSE
+#if defined(__AVX__)
+#define FIEA_KERNELS_AVX
+#endif
+#include <immintrin.h>
+#endif
+
+namespace FieaGameEngine::DatumKernels
+{
+	namespace
+	{
+		template <typename... Spans>
+		void CheckSizes(std::size_t size, const Spans&... spans)
+		{
+			if (((spans.size() != size) || ...))
+			{
+				throw std::runtime_error("Kernel spans must have matching sizes.");
+			}
+		}
+
+		template <typename T>
+		const float* FloatsOf(gsl::span<const T> values)
+		{
+			return reinterpret_cast<const float*>(values.data());
+		}
+
+		template <typename T>
+		float* FloatsOf(gsl::span<T> values)
+		{
+			return reinterpret_cast<float*>(values.data());
+		}
+
+#if defined(FIEA_KERNELS_SSE)
+		/// <summary>
+		/// Returns columns[0] * v.x + columns[1] * v.y + columns[2] * v.z + columns[3] * v.w.
+		/// </summary>
+		inline __m128 Combine(const __m128 columns[4], __m128 v)
+		{
+			__m128 result = _mm_mul_ps(columns[0], _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+			result = _mm_add_ps(result, _mm_mul_ps(columns[1], _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))));
+			result = _mm_add_ps(result, _mm_mul_ps(columns[2], _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2))));
+			return _mm_add_ps(result, _mm_mul_ps(columns[3], _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))));
+		}
+#endif
+	}
+
+	const char* InstructionSet()
+	{
+#if defined(FIEA_KERNELS_AVX)
+		return "AVX";
+#elif defined(FIEA_KERNELS_SSE)
+		return "SSE";
+#else
+		return "Scalar";
+#endif
+	}
+
+	void Add(gsl::span<const glm::vec4> lhs, gsl::span<const glm::vec4> rhs, gsl::span<glm::vec4> result)
+	{
+		CheckSizes(result.size(), lhs, rhs);
+		const float* a = FloatsOf(lhs);
+		const float* b = FloatsOf(rhs);
+		float* out = FloatsOf(result);
+		const std::size_t count = result.size() * 4;
+		std::size_t i = 0;
+
+#if defined(FIEA_KERNELS_AVX)
+		for (; i + 8 <= count; i += 8)
+		{
+			_mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+		}
+#endif
+#if defined(FIEA_KERNELS_SSE)
+		for (; i < count; i += 4)
+		{
+			_mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+		}
+#else
+		for (; i < count; ++i)
+		{
+			out[i] = a[i] + b[i];
+		}
+#endif
+	}
+
+	void Multiply(gsl::span<const glm::vec4> lhs, gsl::span<const glm::vec4> rhs, gsl::span<glm::vec4> result)
+	{
+		CheckSizes(result.size(), lhs, rhs);
+		const float* a = FloatsOf(lhs);
+		const float* b = FloatsOf(rhs);
+		float* out = FloatsOf(result);
+		const std::size_t count = result.size() * 4;
+		std::size_t i = 0;
+
+#if defined(FIEA_KERNELS_AVX)
+		for (; i + 8 <= count; i += 8)
+		{
+			_mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+		}
+#endif
+#if defined(FIEA_KERNELS_SSE)
+		for (; i < count; i += 4)
+		{
+			_mm_storeu_ps(out + i, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+		}
+#else
+		for (; i < count; ++i)
+		{
+			out[i] = a[i] * b[i];
+		}
+#endif
+	}
+
+	void Scale(gsl::span<const glm::vec4> values, float factor, gsl::span<glm::vec4> result)
+	{
+		CheckSizes(result.size(), values);
+		const float* a = FloatsOf(values);
+		float* out = FloatsOf(result);
+		const std::size_t count = result.size() * 4;
+		std::size_t i = 0;
+
+#if defined(FIEA_KERNELS_AVX)
+		const __m256 factor8 = _mm256_set1_ps(factor);
+		for (; i + 8 <= count; i += 8)
+		{
+			_mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_loadu_ps(a + i), factor8));
+		}
+#endif
+#if defined(FIEA_KERNELS_SSE)
+		const __m128 factor4 = _mm_set1_ps(factor);
+		for (; i < count; i += 4)
+		{
+			_mm_storeu_ps(out + i, _mm_mul_ps(_mm_loadu_ps(a + i), factor4));
+		}
+#else
+		for (; i < count; ++i)
+		{
+			out[i] = a[i] * factor;
+		}
+#endif
+	}
+
+	void Lerp(gsl::span<const glm::vec4> from, gsl::span<const glm::vec4> to, float t, gsl::span<glm::vec4> result)
+	{
+		CheckSizes(result.size(), from, to);
+		const float* a = FloatsOf(from);
+		const float* b = FloatsOf(to);
+		float* out = FloatsOf(result);
+		const std::size_t count = result.size() * 4;
+		std::size_t i = 0;
+
+#if defined(FIEA_KERNELS_AVX)
+		const __m256 t8 = _mm256_set1_ps(t);
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m256 start = _mm256_loadu_ps(a + i);
+			_mm256_storeu_ps(out + i, _mm256_add_ps(start, _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(b + i), start), t8)));
+		}
+#endif
+#if defined(FIEA_KERNELS_SSE)
+		const __m128 t4 = _mm_set1_ps(t);
+		for (; i < count; i += 4)
+		{
+			const __m128 start = _mm_loadu_ps(a + i);
+			_mm_storeu_ps(out + i, _mm_add_ps(start, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(b + i), start), t4)));
+		}
+#else
+		for (; i < count; ++i)
+		{
+			out[i] = a[i] + (b[i] - a[i]) * t;
+		}
+#endif
+	}
+
+	void Transform(const glm::mat4& matrix, gsl::span<const glm::vec4> values, gsl::span<glm::vec4> result)
+	{
+		CheckSizes(result.size(), values);
+		std::size_t i = 0;
+
+#if defined(FIEA_KERNELS_SSE)
+		const float* m = reinterpret_cast<const float*>(&matrix);
+		const __m128 columns[4] = { _mm_loadu_ps(m), _mm_loadu_ps(m + 4), _mm_loadu_ps(m + 8), _mm_loadu_ps(m + 12) };
+		const float* in = FloatsOf(values);
+		float* out = FloatsOf(result);
+
+#if defined(FIEA_KERNELS_AVX)
+		const __m256 columns8[4] =
+		{
+			_mm256_set_m128(columns[0], columns[0]), _mm256_set_m128(columns[1], columns[1]),
+			_mm256_set_m128(columns[2], columns[2]), _mm256_set_m128(columns[3], columns[3])
+		};
+		for (; i + 2 <= result.size(); i += 2)
+		{
+			const __m256 v = _mm256_loadu_ps(in + i * 4);
+			__m256 transformed = _mm256_mul_ps(columns8[0], _mm256_permute_ps(v, 0x00));
+			transformed = _mm256_add_ps(transformed, _mm256_mul_ps(columns8[1], _mm256_permute_ps(v, 0x55)));
+			transformed = _mm256_add_ps(transformed, _mm256_mul_ps(columns8[2], _mm256_permute_ps(v, 0xAA)));
+			transformed = _mm256_add_ps(transformed, _mm256_mul_ps(columns8[3], _mm256_permute_ps(v, 0xFF)));
+			_mm256_storeu_ps(out + i * 4, transformed);
+		}
+#endif
+		for (; i < result.size(); ++i)
+		{
+			_mm_storeu_ps(out + i * 4, Combine(columns, _mm_loadu_ps(in + i * 4)));
+		}
+#else
+		for (; i < result.size(); ++i)
+		{
+			result[i] = matrix * values[i];
+		}
+#endif
+	}
+
+	void Multiply(gsl::span<const glm::mat4> lhs, gsl::span<const glm::mat4> rhs, gsl::span<glm::mat4> result)
+	{
+		CheckSizes(result.size(), lhs, rhs);
+
+#if defined(FIEA_KERNELS_SSE)
+		const float* a = FloatsOf(lhs);
+		const float* b = FloatsOf(rhs);
+		float* out = FloatsOf(result);
+		for (std::size_t i = 0; i < result.size(); ++i)
+		{
+			const std::size_t offset = i * 16;
+			const __m128 columns[4] =
+			{
+				_mm_loadu_ps(a + offset), _mm_loadu_ps(a + offset + 4), _mm_loadu_ps(a + offset + 8), _mm_loadu_ps(a + offset + 12)
+			};
+			// Every input is read before any output is written, so result may be lhs or rhs.
+			const __m128 products[4] =
+			{
+				Combine(columns, _mm_loadu_ps(b + offset)), Combine(columns, _mm_loadu_ps(b + offset + 4)),
+				Combine(columns, _mm_loadu_ps(b + offset + 8)), Combine(columns, _mm_loadu_ps(b + offset + 12))
+			};
+			for (std::size_t column = 0; column < 4; ++column)
+			{
+				_mm_storeu_ps(out + offset + column * 4, products[column]);
+			}
+		}
+#else
+		for (std::size_t i = 0; i < result.size(); ++i)
+		{
+			result[i] = lhs[i] * rhs[i];
+		}
+#endif
+	}
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <glm\glm.hpp>
+#include <gsl/gsl>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Batched math over contiguous vec4 and mat4 arrays, such as the spans returned by Datum::Vectors
+	/// and Datum::Matrices. Uses SSE, or AVX when the build targets it, and falls back to scalar glm
+	/// otherwise. Define FIEA_KERNELS_SCALAR to force the scalar path.
+	/// All spans passed to one call must have the same size, or std::runtime_error is thrown.
+	/// The result may be the same span as an input, but must not partially overlap one.
+	/// </summary>
+	namespace DatumKernels
+	{
+		/// <summary>
+		/// Returns the name of the instruction set the kernels were compiled for.
+		/// </summary>
+		const char* InstructionSet();
+
+		/// <summary>
+		/// result[i] = lhs[i] + rhs[i]
+		/// </summary>
+		void Add(gsl::span<const glm::vec4> lhs, gsl::span<const glm::vec4> rhs, gsl::span<glm::vec4> result);
+
+		/// <summary>
+		/// result[i] = lhs[i] * rhs[i], component wise.
+		/// </summary>
+		void Multiply(gsl::span<const glm::vec4> lhs, gsl::span<const glm::vec4> rhs, gsl::span<glm::vec4> result);
+
+		/// <summary>
+		/// result[i] = values[i] * factor
+		/// </summary>
+		void Scale(gsl::span<const glm::vec4> values, float factor, gsl::span<glm::vec4> result);
+
+		/// <summary>
+		/// result[i] = from[i] + (to[i] - from[i]) * t
+		/// </summary>
+		void Lerp(gsl::span<const glm::vec4> from, gsl::span<const glm::vec4> to, float t, gsl::span<glm::vec4> result);
+
+		/// <summary>
+		/// result[i] = matrix * values[i]
+		/// </summary>
+		void Transform(const glm::mat4& matrix, gsl::span<const glm::vec4> values, gsl::span<glm::vec4> result);
+
+		/// <summary>
+		/// result[i] = lhs[i] * rhs[i], as matrix products.
+		/// </summary>
+		void Multiply(gsl::span<const glm::mat4> lhs, gsl::span<const glm::mat4> rhs, gsl::span<glm::mat4> result);
+	}
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Untyped allocator used by containers unless another is supplied. A custom allocator exposes the
+	/// same three members; Reallocate may move the block and is only used for trivially relocatable data.
+	/// </summary>
+	struct DefaultAllocator final
+	{
+		/// <summary>
+		/// Returns a block of at least the given number of bytes. Throws std::bad_alloc on failure.
+		/// </summary>
+		void* Allocate(std::size_t bytes)
+		{
+			void* memory = std::malloc(bytes);
+			if (memory == nullptr)
+			{
+				throw std::bad_alloc();
+			}
+			return memory;
+		}
+
+		/// <summary>
+		/// Resizes the given block, moving its bytes if needed. Throws std::bad_alloc on failure,
+		/// in which case the original block is untouched.
+		/// </summary>
+		void* Reallocate(void* memory, std::size_t bytes)
+		{
+			void* resized = std::realloc(memory, bytes);
+			if (resized == nullptr)
+			{
+				throw std::bad_alloc();
+			}
+			return resized;
+		}
+
+		/// <summary>
+		/// Releases a block returned by Allocate or Reallocate. Null is ignored.
+		/// </summary>
+		void Deallocate(void* memory)
+		{
+			std::free(memory);
+		}
+
+		bool operator==(const DefaultAllocator&) const { return true; }
+		bool operator!=(const DefaultAllocator&) const { return false; }
+	};
+}
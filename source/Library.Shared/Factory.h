@@ -2,6 +2,7 @@
 #include <gsl/gsl>
 #include "RTTI.h"
 #include "Hashmap.h"
+#include "FlatHashmap.h"
 
 namespace FieaGameEngine
 {
@@ -69,7 +70,13 @@ namespace FieaGameEngine
 		static void Remove(std::shared_ptr<Factory> factory);
 
 	private:
-		inline static Hashmap<std::string, std::shared_ptr<const Factory<baseProduct>>> _factories;
+#if defined(FIEA_FACTORY_FLAT_HASHMAP)
+		using map_type = FlatHashmap<std::string, std::shared_ptr<const Factory<baseProduct>>>;
+#else
+		using map_type = Hashmap<std::string, std::shared_ptr<const Factory<baseProduct>>>;
+#endif
+
+		inline static map_type _factories;
 	};
 
 #define ConcreteFactory(DerivedProductType, BaseProductType)	\
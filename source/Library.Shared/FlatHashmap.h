@@ -0,0 +1,368 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <functional>
+#include <cmath>
+#include <algorithm>
+#include <memory>
+#include "Vector.h"
+#include "HashFunctor.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Open addressing hashmap with the same surface as Hashmap. Probing uses Robin Hood ordering over a
+	/// contiguous slot array that caches each key's hash, so a lookup touches one cache line per probe and
+	/// only compares keys whose hashes match. Entries themselves live in paged storage that never moves,
+	/// so references to stored pairs remain valid across inserts, removes of other keys and rehashes.
+	/// Hashing and key comparison are compile time policies, as in Hashmap.
+	/// </summary>
+	template<typename TKey, typename TData, typename THash = HashFunctor<TKey>, typename TEqual = std::equal_to<TKey>>
+	class FlatHashmap final
+	{
+	public:
+		using pair_type = std::pair<const TKey, TData>;
+
+	private:
+		struct Slot final
+		{
+			pair_type* entry{ nullptr };
+			std::size_t hash{ 0 };
+			std::size_t distance{ 0 };
+		};
+
+		struct Page final
+		{
+			pair_type* entries{ nullptr };
+			std::size_t capacity{ 0 };
+			std::size_t used{ 0 };
+		};
+
+		using slot_vector = Vector<Slot>;
+
+	public:
+		class Iterator
+		{
+			friend class FlatHashmap;
+
+		public:
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using value_type = TData;
+			using reference = TData;
+			using iterator_category = std::forward_iterator_tag;
+
+			/// <summary>
+			/// Default constructor for Iterator.
+			/// </summary>
+			Iterator() = default;
+
+			/// <summary>
+			/// Default copy constructor for Iterator.
+			/// </summary>
+			/// <param name="other">The Iterator to be copied.</param>
+			Iterator(const Iterator& other) = default;
+
+			/// <summary>
+			/// Default destructor for Iterator.
+			/// </summary>
+			~Iterator() = default;
+
+			/// <summary>
+			/// Default Assignment Operator for Iterator.
+			/// </summary>
+			Iterator& operator=(const Iterator& other) = default;
+
+			/// <summary>
+			/// Equivalence operator.
+			/// </summary>
+			/// <param name="rhs">Right hand side of operator.</param>
+			/// <returns>Boolean.</returns>
+			bool operator==(const Iterator& rhs) const;
+
+			/// <summary>
+			/// UnEquivalence operator.
+			/// </summary>
+			/// <param name="rhs">Right hand side of operator.</param>
+			/// <returns>Boolean.</returns>
+			bool operator!=(const Iterator& rhs) const;
+
+			/// <summary>
+			/// PreIncrement operator.
+			/// </summary>
+			/// <returns>Iterator reference.</returns>
+			Iterator& operator++();
+
+			/// <summary>
+			/// PostIncrement operator.
+			/// </summary>
+			/// <returns>Iterator.</returns>
+			Iterator operator++(int);
+
+			/// <summary>
+			/// Dereference operator, returns key data pair reference.
+			/// </summary>
+			pair_type& operator*() const;
+
+		private:
+			Iterator(FlatHashmap& owner, std::size_t index);
+			FlatHashmap* owner{ nullptr };
+			std::size_t index{ 0 };
+		};
+
+		class ConstIterator
+		{
+			friend class FlatHashmap;
+
+		public:
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using value_type = TData;
+			using reference = TData;
+			using iterator_category = std::forward_iterator_tag;
+
+			/// <summary>
+			/// Default constructor for ConstIterator.
+			/// </summary>
+			ConstIterator() = default;
+
+			/// <summary>
+			/// Default copy constructor for ConstIterator.
+			/// </summary>
+			/// <param name="other">ConstIterator to be copied.</param>
+			ConstIterator(const ConstIterator& other) = default;
+
+			/// <summary>
+			/// Conversion of Iterator to ConstIterator.
+			/// </summary>
+			/// <param name="other">Given Iterator.</param>
+			ConstIterator(const Iterator& other);
+
+			/// <summary>
+			/// Default ConstIterator destructor.
+			/// </summary>
+			~ConstIterator() = default;
+
+			/// <summary>
+			/// Default Assignment Operator for ConstIterator.
+			/// </summary>
+			ConstIterator& operator=(const ConstIterator& other) = default;
+
+			/// <summary>
+			/// Equivalence operator.
+			/// </summary>
+			/// <param name="rhs">Right hand side of operator.</param>
+			/// <returns>Boolean.</returns>
+			bool operator==(const ConstIterator& rhs) const;
+
+			/// <summary>
+			/// UnEquivalence operator.
+			/// </summary>
+			/// <param name="rhs">Right hand side of operator.</param>
+			/// <returns>Boolean.</returns>
+			bool operator!=(const ConstIterator& rhs) const;
+
+			/// <summary>
+			/// PreIncrement operator.
+			/// </summary>
+			/// <returns>ConstIterator reference.</returns>
+			ConstIterator& operator++();
+
+			/// <summary>
+			/// PostIncrement operator.
+			/// </summary>
+			/// <returns>ConstIterator.</returns>
+			ConstIterator operator++(int);
+
+			/// <summary>
+			/// Dereference operator, returns key data pair reference.
+			/// </summary>
+			const pair_type& operator*() const;
+
+		private:
+			ConstIterator(const FlatHashmap& owner, std::size_t index);
+			const FlatHashmap* owner{ nullptr };
+			std::size_t index{ 0 };
+		};
+
+		/// <summary>
+		/// Constructor with three parameters, each with defaults. bucketCount cannot be < 2.
+		/// </summary>
+		/// <param name="bucketCount">Initial number of slots.</param>
+		/// <param name="HashFunction">Function for generating index for any key.</param>
+		/// <param name="EqualityFunction">Function for determining equality between keys.</param>
+		explicit FlatHashmap(std::size_t bucketCount = 11,
+			const THash& hashFunction = THash{}, const TEqual& equalityFunction = TEqual{});
+
+		/// <summary>
+		/// Constructor that takes an initializer list of pair entries.
+		/// </summary>
+		/// <param name="HashFunction">Function for generating index for any key.</param>
+		/// <param name="EqualityFunction">Function for determining equality between keys.</param>
+		explicit FlatHashmap(std::initializer_list<pair_type> list,
+			const THash& hashFunction = THash{}, const TEqual& equalityFunction = TEqual{});
+
+		/// <summary>
+		/// Copy constructor, produces FlatHashmap from given FlatHashmap instance.
+		/// </summary>
+		FlatHashmap(const FlatHashmap& other);
+
+		/// <summary>
+		/// Move constructor, takes the slots and entry pages of the given map, then zeroes it out.
+		/// </summary>
+		/// <param name="other">R value FlatHashmap.</param>
+		FlatHashmap(FlatHashmap&& other) noexcept;
+
+		/// <summary>
+		/// Copy assignment operator, sets lhs equal to given rhs FlatHashmap.
+		/// </summary>
+		FlatHashmap& operator=(const FlatHashmap& other);
+
+		/// <summary>
+		/// Move assignment operator, sets lhs L value equal to rhs R value, then zeroes out rhs.
+		/// </summary>
+		/// <param name="other">R value FlatHashmap.</param>
+		FlatHashmap& operator=(FlatHashmap&& other) noexcept;
+
+		/// <summary>
+		/// Destructor, destroys all entries and releases entry pages.
+		/// </summary>
+		~FlatHashmap();
+
+		/// <summary>
+		/// Returns Iterator pointing to data associated with given key, or end() if unfound.
+		/// </summary>
+		Iterator Find(const TKey& key);
+
+		/// <summary>
+		/// Returns ConstIterator pointing to data associated with given key, or cend() if unfound.
+		/// </summary>
+		ConstIterator Find(const TKey& key) const;
+
+		/// <summary>
+		/// Inserts Key-Data pair into FlatHashmap then returns Iterator pointing to data.
+		/// Invalidates existing Iterators, but not references to entries.
+		/// </summary>
+		/// <param name="entry">Key-Data pair.</param>
+		std::pair<Iterator, bool> Insert(const pair_type& entry);
+
+		/// <summary>
+		/// Returns the data reference associated with given key. If key does not exist in map,
+		/// an entry for it is created.
+		/// </summary>
+		TData& operator[](const TKey& key);
+
+		/// <summary>
+		/// Removes entry associated with given key, if it exists.
+		/// </summary>
+		bool Remove(const TKey& key);
+
+		/// <summary>
+		/// Removes entry associated with given iterator. Invalidates existing Iterators.
+		/// </summary>
+		bool Remove(const Iterator& it);
+
+		/// <summary>
+		/// Removes all entries from the FlatHashmap. Slot count is kept.
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Returns number of entries currently in FlatHashmap.
+		/// </summary>
+		std::size_t Size() const;
+
+		/// <summary>
+		/// Number of available slots in map.
+		/// </summary>
+		std::size_t BucketCount() const;
+
+		/// <summary>
+		/// Ratio of number of entries to available slots.
+		/// </summary>
+		float LoadFactor() const;
+
+		/// <summary>
+		/// Load factor above which an insert grows the slot count.
+		/// </summary>
+		float MaxLoadFactor() const;
+
+		/// <summary>
+		/// Sets the load factor above which an insert grows the slot count. Must be in (0, 1), since
+		/// open addressing needs free slots to terminate probes. Rehashes immediately if exceeded.
+		/// </summary>
+		void SetMaxLoadFactor(float maxLoadFactor);
+
+		/// <summary>
+		/// Redistributes entries into at least the given number of slots, never fewer than the current
+		/// size allows under the max load factor. Entries are not moved. Invalidates all Iterators.
+		/// </summary>
+		void Rehash(std::size_t bucketCount);
+
+		/// <summary>
+		/// Grows the slot count and entry storage so the given number of entries can be held without
+		/// further rehashing or page allocation.
+		/// </summary>
+		void Reserve(std::size_t entryCount);
+
+		/// <summary>
+		/// Returns whether given key exists in this map.
+		/// </summary>
+		bool ContainsKey(const TKey& key) const;
+
+		/// <summary>
+		/// Returns data reference associated with given key. Throws if key does not exist.
+		/// </summary>
+		TData& At(const TKey& key);
+
+		/// <summary>
+		/// Returns const data reference associated with given key. Throws if key does not exist.
+		/// </summary>
+		const TData& At(const TKey& key) const;
+
+		/// <summary>
+		/// Returns Iterator pointing to first found entry in map.
+		/// </summary>
+		Iterator begin();
+
+		/// <summary>
+		/// Returns ConstIterator pointing to first found entry in map.
+		/// </summary>
+		ConstIterator cbegin() const;
+
+		/// <summary>
+		/// Returns Iterator pointing past the final slot.
+		/// </summary>
+		Iterator end();
+
+		/// <summary>
+		/// Returns ConstIterator pointing past the final slot.
+		/// </summary>
+		ConstIterator cend() const;
+
+	private:
+		inline static const std::size_t MinimumPageCapacity = 16;
+
+		static std::size_t Mix(std::size_t hash);
+		std::size_t FindIndex(const TKey& key, std::size_t hash) const;
+		std::size_t Place(Slot slot);
+		void RemoveAt(std::size_t index);
+		std::size_t BucketsFor(std::size_t entryCount) const;
+		std::size_t FirstOccupied() const;
+		pair_type* AcquireEntry();
+		void AddPage(std::size_t capacity);
+		void ReleasePages();
+
+		slot_vector _slots{ };
+		Vector<Page> _pages{ };
+		Vector<pair_type*> _freeEntries{ };
+		THash _hashFunction;
+		TEqual _equalityFunction;
+		std::size_t _size{ 0 };
+		float _maxLoadFactor{ 0.875f };
+	};
+}
+
+#include "FlatHashmap.inl"
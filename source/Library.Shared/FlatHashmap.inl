@@ -0,0 +1,637 @@
+#include "FlatHashmap.h"
+
+namespace FieaGameEngine
+{
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	FlatHashmap<TKey, TData, THash, TEqual>::Iterator::Iterator(FlatHashmap& owner, std::size_t index) :
+		owner(&owner), index(index)
+	{
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	bool FlatHashmap<TKey, TData, THash, TEqual>::Iterator::operator==(const Iterator& rhs) const
+	{
+		return !operator!=(rhs);
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	bool FlatHashmap<TKey, TData, THash, TEqual>::Iterator::operator!=(const Iterator& rhs) const
+	{
+		return owner != rhs.owner || index != rhs.index;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	typename FlatHashmap<TKey, TData, THash, TEqual>::Iterator& FlatHashmap<TKey, TData, THash, TEqual>::Iterator::operator++()
+	{
+		if (owner == nullptr)
+		{
+			throw std::runtime_error("Cannot increment Iterator with no owning container.");
+		}
+
+		const std::size_t capacity = owner->_slots.Size();
+		if (index < capacity)
+		{
+			++index;
+			while (index < capacity && owner->_slots[index].distance == 0)
+			{
+				++index;
+			}
+		}
+		return *this;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	typename FlatHashmap<TKey, TData, THash, TEqual>::Iterator FlatHashmap<TKey, TData, THash, TEqual>::Iterator::operator++(int)
+	{
+		Iterator temp = *this;
+		++(*this);
+		return temp;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	inline typename FlatHashmap<TKey, TData, THash, TEqual>::pair_type& FlatHashmap<TKey, TData, THash, TEqual>::Iterator::operator*() const
+	{
+		if (owner == nullptr)
+		{
+			throw std::runtime_error("Iterator is not associated with a FlatHashmap.");
+		}
+		if (index >= owner->_slots.Size())
+		{
+			throw std::runtime_error("Cannot dereference end of FlatHashmap.");
+		}
+
+		return *owner->_slots[index].entry;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	FlatHashmap<TKey, TData, THash, TEqual>::ConstIterator::ConstIterator(const FlatHashmap& owner, std::size_t index) :
+		owner(&owner), index(index)
+	{
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	FlatHashmap<TKey, TData, THash, TEqual>::ConstIterator::ConstIterator(const Iterator& other) :
+		owner(other.owner), index(other.index)
+	{
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	bool FlatHashmap<TKey, TData, THash, TEqual>::ConstIterator::operator==(const ConstIterator& rhs) const
+	{
+		return !operator!=(rhs);
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	bool FlatHashmap<TKey, TData, THash, TEqual>::ConstIterator::operator!=(const ConstIterator& rhs) const
+	{
+		return owner != rhs.owner || index != rhs.index;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	typename FlatHashmap<TKey, TData, THash, TEqual>::ConstIterator& FlatHashmap<TKey, TData, THash, TEqual>::ConstIterator::operator++()
+	{
+		if (owner == nullptr)
+		{
+			throw std::runtime_error("Cannot increment Iterator with no owning container.");
+		}
+
+		const std::size_t capacity = owner->_slots.Size();
+		if (index < capacity)
+		{
+			++index;
+			while (index < capacity && owner->_slots[index].distance == 0)
+			{
+				++index;
+			}
+		}
+		return *this;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	typename FlatHashmap<TKey, TData, THash, TEqual>::ConstIterator FlatHashmap<TKey, TData, THash, TEqual>::ConstIterator::operator++(int)
+	{
+		ConstIterator temp = *this;
+		++(*this);
+		return temp;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	inline const typename FlatHashmap<TKey, TData, THash, TEqual>::pair_type& FlatHashmap<TKey, TData, THash, TEqual>::ConstIterator::operator*() const
+	{
+		if (owner == nullptr)
+		{
+			throw std::runtime_error("Iterator is not associated with a FlatHashmap.");
+		}
+		if (index >= owner->_slots.Size())
+		{
+			throw std::runtime_error("Cannot dereference end of FlatHashmap.");
+		}
+
+		return *owner->_slots[index].entry;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	FlatHashmap<TKey, TData, THash, TEqual>::FlatHashmap(std::size_t bucketCount,
+		const THash& hashFunction, const TEqual& equalityFunction) :
+		_slots(bucketCount), _hashFunction(hashFunction), _equalityFunction(equalityFunction)
+	{
+		if (bucketCount < 2)
+		{
+			throw std::runtime_error("bucketCount cannot be less than 2.");
+		}
+
+		_slots.Resize(bucketCount);
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	FlatHashmap<TKey, TData, THash, TEqual>::FlatHashmap(std::initializer_list<pair_type> list,
+		const THash& hashFunction, const TEqual& equalityFunction) :
+		_hashFunction(hashFunction), _equalityFunction(equalityFunction)
+	{
+		std::size_t bucketCount = BucketsFor(list.size());
+		_slots.Reserve(bucketCount);
+		_slots.Resize(bucketCount);
+
+		for (auto& pair : list)
+		{
+			Insert(pair);
+		}
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	FlatHashmap<TKey, TData, THash, TEqual>::FlatHashmap(const FlatHashmap& other) :
+		_slots(other._slots.Size()), _hashFunction(other._hashFunction),
+		_equalityFunction(other._equalityFunction), _maxLoadFactor(other._maxLoadFactor)
+	{
+		_slots.Resize(other._slots.Size());
+		if (other._size > 0)
+		{
+			AddPage(other._size);
+		}
+
+		for (ConstIterator it = other.cbegin(); it != other.cend(); ++it)
+		{
+			Insert(*it);
+		}
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	FlatHashmap<TKey, TData, THash, TEqual>::FlatHashmap(FlatHashmap&& other) noexcept :
+		_slots(std::move(other._slots)), _pages(std::move(other._pages)),
+		_freeEntries(std::move(other._freeEntries)), _hashFunction(std::move(other._hashFunction)),
+		_equalityFunction(std::move(other._equalityFunction)), _size(other._size),
+		_maxLoadFactor(other._maxLoadFactor)
+	{
+		other._size = 0;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	FlatHashmap<TKey, TData, THash, TEqual>& FlatHashmap<TKey, TData, THash, TEqual>::operator=(const FlatHashmap& other)
+	{
+		if (this != &other)
+		{
+			Clear();
+			_hashFunction = other._hashFunction;
+			_equalityFunction = other._equalityFunction;
+			_maxLoadFactor = other._maxLoadFactor;
+
+			_slots = slot_vector(other._slots.Size());
+			_slots.Resize(other._slots.Size());
+			if (other._size > 0)
+			{
+				AddPage(other._size);
+			}
+
+			for (ConstIterator it = other.cbegin(); it != other.cend(); ++it)
+			{
+				Insert(*it);
+			}
+		}
+		return *this;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	FlatHashmap<TKey, TData, THash, TEqual>& FlatHashmap<TKey, TData, THash, TEqual>::operator=(FlatHashmap&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Clear();
+			_slots = std::move(other._slots);
+			_pages = std::move(other._pages);
+			_freeEntries = std::move(other._freeEntries);
+			_hashFunction = other._hashFunction;
+			_equalityFunction = other._equalityFunction;
+			_size = other._size;
+			_maxLoadFactor = other._maxLoadFactor;
+			other._size = 0;
+		}
+		return *this;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	FlatHashmap<TKey, TData, THash, TEqual>::~FlatHashmap()
+	{
+		Clear();
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	typename FlatHashmap<TKey, TData, THash, TEqual>::Iterator FlatHashmap<TKey, TData, THash, TEqual>::Find(const TKey& key)
+	{
+		if (_size > 0)
+		{
+			return Iterator(*this, FindIndex(key, Mix(_hashFunction(key))));
+		}
+		return end();
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	typename FlatHashmap<TKey, TData, THash, TEqual>::ConstIterator FlatHashmap<TKey, TData, THash, TEqual>::Find(const TKey& key) const
+	{
+		if (_size > 0)
+		{
+			return ConstIterator(*this, FindIndex(key, Mix(_hashFunction(key))));
+		}
+		return cend();
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	std::pair<typename FlatHashmap<TKey, TData, THash, TEqual>::Iterator, bool> FlatHashmap<TKey, TData, THash, TEqual>::Insert(const pair_type& entry)
+	{
+		const std::size_t hash = Mix(_hashFunction(entry.first));
+		if (_size > 0)
+		{
+			std::size_t index = FindIndex(entry.first, hash);
+			if (index != _slots.Size())
+			{
+				return std::make_pair(Iterator(*this, index), false);
+			}
+		}
+
+		if (_size + 1 > _maxLoadFactor * _slots.Size())
+		{
+			Rehash(std::max(_slots.Size() * 2, BucketsFor(_size + 1)));
+		}
+
+		pair_type* newEntry = AcquireEntry();
+		try
+		{
+			new (newEntry) pair_type(entry);
+		}
+		catch (...)
+		{
+			_freeEntries.PushBack(newEntry);
+			throw;
+		}
+
+		std::size_t index = Place(Slot{ newEntry, hash, 1 });
+		++_size;
+		return std::make_pair(Iterator(*this, index), true);
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	TData& FlatHashmap<TKey, TData, THash, TEqual>::operator[](const TKey& key)
+	{
+		Iterator it = Find(key);
+		if (it != end())
+		{
+			return (*it).second;
+		}
+		else
+		{
+			return (*Insert(std::make_pair(key, TData())).first).second;
+		}
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	bool FlatHashmap<TKey, TData, THash, TEqual>::Remove(const TKey& key)
+	{
+		Iterator it = Find(key);
+		if (it != end())
+		{
+			RemoveAt(it.index);
+			return true;
+		}
+		return false;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	bool FlatHashmap<TKey, TData, THash, TEqual>::Remove(const Iterator& it)
+	{
+		if (it.owner != this)
+		{
+			throw std::runtime_error("Given Iterator is not associated with this map instance.");
+		}
+
+		if (it.index < _slots.Size() && _slots[it.index].distance != 0)
+		{
+			RemoveAt(it.index);
+			return true;
+		}
+		return false;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	void FlatHashmap<TKey, TData, THash, TEqual>::Clear()
+	{
+		for (auto& slot : _slots)
+		{
+			if (slot.distance != 0)
+			{
+				slot.entry->~pair_type();
+				slot = Slot{ };
+			}
+		}
+
+		ReleasePages();
+		_size = 0;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	inline std::size_t FlatHashmap<TKey, TData, THash, TEqual>::Size() const
+	{
+		return _size;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	inline std::size_t FlatHashmap<TKey, TData, THash, TEqual>::BucketCount() const
+	{
+		return _slots.Size();
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	inline float FlatHashmap<TKey, TData, THash, TEqual>::LoadFactor() const
+	{
+		return _slots.Size() > 0 ? float(_size) / _slots.Size() : 0.0f;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	inline float FlatHashmap<TKey, TData, THash, TEqual>::MaxLoadFactor() const
+	{
+		return _maxLoadFactor;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	void FlatHashmap<TKey, TData, THash, TEqual>::SetMaxLoadFactor(float maxLoadFactor)
+	{
+		if (maxLoadFactor <= 0.0f || maxLoadFactor >= 1.0f)
+		{
+			throw std::runtime_error("Max load factor must be between 0 and 1.");
+		}
+
+		_maxLoadFactor = maxLoadFactor;
+		if (_size > _maxLoadFactor * _slots.Size())
+		{
+			Rehash(BucketsFor(_size));
+		}
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	void FlatHashmap<TKey, TData, THash, TEqual>::Rehash(std::size_t bucketCount)
+	{
+		bucketCount = std::max(bucketCount, BucketsFor(_size));
+		if (bucketCount == _slots.Size())
+		{
+			return;
+		}
+
+		slot_vector oldSlots = std::move(_slots);
+		_slots = slot_vector(bucketCount);
+		_slots.Resize(bucketCount);
+
+		for (auto& slot : oldSlots)
+		{
+			if (slot.distance != 0)
+			{
+				slot.distance = 1;
+				Place(slot);
+			}
+		}
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	void FlatHashmap<TKey, TData, THash, TEqual>::Reserve(std::size_t entryCount)
+	{
+		std::size_t bucketCount = BucketsFor(entryCount);
+		if (bucketCount > _slots.Size())
+		{
+			Rehash(bucketCount);
+		}
+
+		std::size_t available = _freeEntries.Size();
+		if (!_pages.IsEmpty())
+		{
+			available += _pages.Back().capacity - _pages.Back().used;
+		}
+		if (entryCount > _size + available)
+		{
+			AddPage(entryCount - _size - available);
+		}
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	bool FlatHashmap<TKey, TData, THash, TEqual>::ContainsKey(const TKey& key) const
+	{
+		return Find(key) != cend();
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	TData& FlatHashmap<TKey, TData, THash, TEqual>::At(const TKey& key)
+	{
+		return (*Find(key)).second;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	const TData& FlatHashmap<TKey, TData, THash, TEqual>::At(const TKey& key) const
+	{
+		return (*Find(key)).second;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	inline typename FlatHashmap<TKey, TData, THash, TEqual>::Iterator FlatHashmap<TKey, TData, THash, TEqual>::begin()
+	{
+		return Iterator(*this, FirstOccupied());
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	inline typename FlatHashmap<TKey, TData, THash, TEqual>::ConstIterator FlatHashmap<TKey, TData, THash, TEqual>::cbegin() const
+	{
+		return ConstIterator(*this, FirstOccupied());
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	inline typename FlatHashmap<TKey, TData, THash, TEqual>::Iterator FlatHashmap<TKey, TData, THash, TEqual>::end()
+	{
+		return Iterator(*this, _slots.Size());
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	inline typename FlatHashmap<TKey, TData, THash, TEqual>::ConstIterator FlatHashmap<TKey, TData, THash, TEqual>::cend() const
+	{
+		return ConstIterator(*this, _slots.Size());
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	std::size_t FlatHashmap<TKey, TData, THash, TEqual>::FindIndex(const TKey& key, std::size_t hash) const
+	{
+		const std::size_t capacity = _slots.Size();
+		std::size_t index = hash % capacity;
+
+		// Robin Hood ordering means no entry for this key can sit past a slot that is closer to its own home.
+		for (std::size_t distance = 1; ; ++distance)
+		{
+			const Slot& slot = _slots[index];
+			if (slot.distance < distance)
+			{
+				return capacity;
+			}
+			if (slot.hash == hash && _equalityFunction(slot.entry->first, key))
+			{
+				return index;
+			}
+			if (++index == capacity)
+			{
+				index = 0;
+			}
+		}
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	std::size_t FlatHashmap<TKey, TData, THash, TEqual>::Place(Slot slot)
+	{
+		const std::size_t capacity = _slots.Size();
+		std::size_t index = slot.hash % capacity;
+		std::size_t placedIndex = capacity;
+
+		while (true)
+		{
+			Slot& current = _slots[index];
+			if (current.distance == 0)
+			{
+				current = slot;
+				return placedIndex == capacity ? index : placedIndex;
+			}
+
+			if (current.distance < slot.distance)
+			{
+				std::swap(current, slot);
+				if (placedIndex == capacity)
+				{
+					placedIndex = index;
+				}
+			}
+
+			if (++index == capacity)
+			{
+				index = 0;
+			}
+			++slot.distance;
+		}
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	void FlatHashmap<TKey, TData, THash, TEqual>::RemoveAt(std::size_t index)
+	{
+		pair_type* entry = _slots[index].entry;
+		entry->~pair_type();
+		_freeEntries.PushBack(entry);
+
+		const std::size_t capacity = _slots.Size();
+		std::size_t next = index + 1 == capacity ? 0 : index + 1;
+		while (_slots[next].distance > 1)
+		{
+			_slots[index] = _slots[next];
+			--_slots[index].distance;
+			index = next;
+			next = next + 1 == capacity ? 0 : next + 1;
+		}
+		_slots[index] = Slot{ };
+		--_size;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	inline std::size_t FlatHashmap<TKey, TData, THash, TEqual>::Mix(std::size_t hash)
+	{
+		// Linear probing degrades badly when keys hash to runs of neighbouring values, so the hash is
+		// scrambled before it picks a home slot.
+		std::uint64_t mixed = static_cast<std::uint64_t>(hash);
+		mixed ^= mixed >> 33;
+		mixed *= 0xff51afd7ed558ccdULL;
+		mixed ^= mixed >> 33;
+		return static_cast<std::size_t>(mixed);
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	inline std::size_t FlatHashmap<TKey, TData, THash, TEqual>::BucketsFor(std::size_t entryCount) const
+	{
+		std::size_t bucketCount = static_cast<std::size_t>(std::ceil(entryCount / _maxLoadFactor));
+		return std::max({ bucketCount, entryCount + 1, std::size_t(2) });
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	std::size_t FlatHashmap<TKey, TData, THash, TEqual>::FirstOccupied() const
+	{
+		std::size_t index = 0;
+		if (_size > 0)
+		{
+			while (_slots[index].distance == 0)
+			{
+				++index;
+			}
+			return index;
+		}
+		return _slots.Size();
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	typename FlatHashmap<TKey, TData, THash, TEqual>::pair_type* FlatHashmap<TKey, TData, THash, TEqual>::AcquireEntry()
+	{
+		if (!_freeEntries.IsEmpty())
+		{
+			pair_type* entry = _freeEntries.Back();
+			_freeEntries.PopBack();
+			return entry;
+		}
+
+		if (_pages.IsEmpty() || _pages.Back().used == _pages.Back().capacity)
+		{
+			AddPage(std::max(MinimumPageCapacity, _size));
+		}
+
+		Page& page = _pages.Back();
+		return page.entries + page.used++;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	void FlatHashmap<TKey, TData, THash, TEqual>::AddPage(std::size_t capacity)
+	{
+		// Leftover room in the current page is handed to the free list so it is not stranded.
+		if (!_pages.IsEmpty())
+		{
+			Page& page = _pages.Back();
+			while (page.used < page.capacity)
+			{
+				_freeEntries.PushBack(page.entries + page.used++);
+			}
+		}
+
+		// Owned by the guard until _pages holds it, so a failing PushBack does not leak it.
+		std::unique_ptr<pair_type, decltype(&free)> entries(static_cast<pair_type*>(malloc(sizeof(pair_type) * capacity)), &free);
+		if (entries == nullptr)
+		{
+			throw std::runtime_error("Failed to allocate FlatHashmap entry page.");
+		}
+		_pages.PushBack(Page{ entries.get(), capacity, 0 });
+		entries.release();
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	void FlatHashmap<TKey, TData, THash, TEqual>::ReleasePages()
+	{
+		for (auto& page : _pages)
+		{
+			free(page.entries);
+		}
+		_pages.Clear();
+		_freeEntries.Clear();
+	}
+}
@@ -1,36 +1,224 @@
 #include "pch.h"
 #include "GameObject.h"
 #include "Action.h"
+#include "ActionIncrement.h"
 
 namespace FieaGameEngine
 {
+	namespace
+	{
+		const NameId& ChildrenName()
+		{
+			static const NameId name("Children"s);
+			return name;
+		}
+
+		const NameId& ActionsName()
+		{
+			static const NameId name("Actions"s);
+			return name;
+		}
+
+		const NameId& PositionName()
+		{
+			static const NameId name("Position"s);
+			return name;
+		}
+
+		const NameId& RotationName()
+		{
+			static const NameId name("Rotation"s);
+			return name;
+		}
+
+		const NameId& ScaleName()
+		{
+			static const NameId name("Scale"s);
+			return name;
+		}
+	}
+
 	RTTI_DEFINITIONS(GameObject)
 
 	GameObject::GameObject() :
-		Attributed(GameObject::TypeIdClass())
+		Attributed(GameObject::TypeIdClass()),
+		_childrenIndex(PrescribedAttributeIndex(ChildrenName())),
+		_actionsIndex(PrescribedAttributeIndex(ActionsName())),
+		_transformIndex(PrescribedAttributeIndex(PositionName()))
+	{
+	}
+
+	GameObject::GameObject(TransformStore& store) :
+		GameObject()
+	{
+		SetTransformStore(&store);
+	}
+
+	GameObject::GameObject(const GameObject& other) :
+		Attributed(other), Name(other.Name),
+		_position(other.Position()), _rotation(other.Rotation()), _scale(other.Scale()),
+		_childrenIndex(other._childrenIndex), _actionsIndex(other._actionsIndex), _transformIndex(other._transformIndex)
 	{
+		SetTransformStore(other._transformStore);
+	}
+
+	GameObject& GameObject::operator=(const GameObject& other)
+	{
+		if (&other != this)
+		{
+			Attributed::operator=(other);
+			Name = other.Name;
+			DiscardActionQueue();
+			_childrenIndex = other._childrenIndex;
+			_actionsIndex = other._actionsIndex;
+			_transformIndex = other._transformIndex;
+			Position() = other.Position();
+			Rotation() = other.Rotation();
+			Scale() = other.Scale();
+			BindTransform();
+		}
+		return *this;
+	}
+
+	GameObject::GameObject(GameObject&& other) noexcept :
+		Attributed(std::move(other)), Name(std::move(other.Name)), _actionQueue(std::move(other._actionQueue)),
+		_position(other._position), _rotation(other._rotation), _scale(other._scale),
+		_transformStore(other._transformStore), _transformHandle(other._transformHandle),
+		_childrenIndex(other._childrenIndex), _actionsIndex(other._actionsIndex), _transformIndex(other._transformIndex)
+	{
+		other._transformStore = nullptr;
+		other._transformHandle = TransformStore::InvalidHandle;
+		BindTransform();
+		for (QueuedAction& queued : _actionQueue)
+		{
+			if (queued._parent == &other)
+			{
+				queued._parent = this;
+			}
+		}
+	}
+
+	GameObject& GameObject::operator=(GameObject&& other) noexcept
+	{
+		if (&other != this)
+		{
+			Attributed::operator=(std::move(other));
+			Name = std::move(other.Name);
+			DiscardActionQueue();
+			_actionQueue = std::move(other._actionQueue);
+			for (QueuedAction& queued : _actionQueue)
+			{
+				if (queued._parent == &other)
+				{
+					queued._parent = this;
+				}
+			}
+			_childrenIndex = other._childrenIndex;
+			_actionsIndex = other._actionsIndex;
+			_transformIndex = other._transformIndex;
+
+			if (_transformStore != nullptr)
+			{
+				_transformStore->Release(_transformHandle);
+			}
+			_position = other._position;
+			_rotation = other._rotation;
+			_scale = other._scale;
+			_transformStore = other._transformStore;
+			_transformHandle = other._transformHandle;
+			other._transformStore = nullptr;
+			other._transformHandle = TransformStore::InvalidHandle;
+			BindTransform();
+		}
+		return *this;
 	}
 
 	GameObject::~GameObject()
 	{
+		DiscardActionQueue();
+		if (_transformStore != nullptr)
+		{
+			_transformStore->Release(_transformHandle);
+		}
+	}
+
+	glm::vec4& GameObject::Position()
+	{
+		return _transformStore != nullptr ? _transformStore->Position(_transformHandle) : _position;
+	}
+
+	const glm::vec4& GameObject::Position() const
+	{
+		return _transformStore != nullptr ? _transformStore->Position(_transformHandle) : _position;
+	}
+
+	glm::vec4& GameObject::Rotation()
+	{
+		return _transformStore != nullptr ? _transformStore->Rotation(_transformHandle) : _rotation;
+	}
+
+	const glm::vec4& GameObject::Rotation() const
+	{
+		return _transformStore != nullptr ? _transformStore->Rotation(_transformHandle) : _rotation;
+	}
+
+	glm::vec4& GameObject::Scale()
+	{
+		return _transformStore != nullptr ? _transformStore->Scale(_transformHandle) : _scale;
+	}
+
+	const glm::vec4& GameObject::Scale() const
+	{
+		return _transformStore != nullptr ? _transformStore->Scale(_transformHandle) : _scale;
+	}
+
+	void GameObject::SetTransformStore(TransformStore* store)
+	{
+		if (store == _transformStore)
+		{
+			return;
+		}
+
+		const glm::vec4 position = Position();
+		const glm::vec4 rotation = Rotation();
+		const glm::vec4 scale = Scale();
+		const TransformStore::Handle handle = store != nullptr ? store->Acquire() : TransformStore::InvalidHandle;
+		if (_transformStore != nullptr)
+		{
+			_transformStore->Release(_transformHandle);
+		}
+		_transformStore = store;
+		_transformHandle = handle;
+
+		Position() = position;
+		Rotation() = rotation;
+		Scale() = scale;
+		BindTransform();
+	}
+
+	TransformStore* GameObject::GetTransformStore() const
+	{
+		return _transformStore;
+	}
+
+	TransformStore::Handle GameObject::TransformHandle() const
+	{
+		return _transformHandle;
 	}
 
 	Datum& GameObject::Children()
 	{
-		Datum* children = Find("Children");
-		assert(children != nullptr);
-		return *children;
+		return PrescribedAttribute(_childrenIndex);
 	}
 
 	GameObject& GameObject::GetChild(std::size_t index)
 	{
-		Datum* children = Find("Children");
-		assert(children != nullptr);
-		if (index >= children->Size())
+		Datum& children = Children();
+		if (index >= children.Size())
 		{
 			throw std::runtime_error("Invalid index for children.");
 		}
-		GameObject& child = static_cast<GameObject&>(children->GetTable(index));
+		GameObject& child = static_cast<GameObject&>(children.GetTable(index));
 		return child;
 	}
 
@@ -42,56 +230,99 @@ namespace FieaGameEngine
 		assert(actionPtr != nullptr);
 
 		actionPtr->SetName(instanceName);
-		Adopt(*actionPtr, "Actions");
+		Adopt(*actionPtr, ActionsName());
 		return actionPtr;
 	}
 
 	Datum& GameObject::Actions()
 	{
-		Datum* actions = Find("Actions");
-		assert(actions != nullptr);
-		return *actions;
+		return PrescribedAttribute(_actionsIndex);
 	}
 
 	Action& GameObject::GetAction(std::size_t index)
 	{
-		Datum* actions = Find("Actions");
-		assert(actions != nullptr);
-		if (index >= actions->Size())
+		Datum& actions = Actions();
+		if (index >= actions.Size())
 		{
 			throw std::runtime_error("Invalid index for actions.");
 		}
-		Action& child = static_cast<Action&>(actions->GetTable(index));
+		Action& child = static_cast<Action&>(actions.GetTable(index));
 		return child;
 	}
 
 	void GameObject::Update(const GameTime& time)
 	{
-		assert(Find("Children") != nullptr);
-		assert(Find("Actions") != nullptr);
+		UpdateSubtree(time);
+		ApplySubtreeActionQueues();
+	}
 
-		for (std::size_t i = 0; i < Find("Children")->Size(); ++i)
+	void GameObject::UpdateSubtree(const GameTime& time)
+	{
+		Datum& children = Children();
+		for (std::size_t i = 0; i < children.Size(); ++i)
 		{
-			GetChild(i).Update(time);
+			static_cast<GameObject&>(children.GetTable(i)).UpdateSubtree(time);
 		}
 
-		for (std::size_t i = 0; i < Find("Actions")->Size(); ++i)
+		UpdateSelf(time);
+	}
+
+	void GameObject::ApplySubtreeActionQueues()
+	{
+		// Applying only touches Actions, so the children stay put while this walks them.
+		Datum& children = Children();
+		for (std::size_t i = 0; i < children.Size(); ++i)
 		{
-			GetAction(i).Update(time);
+			static_cast<GameObject&>(children.GetTable(i)).ApplySubtreeActionQueues();
 		}
+
+		ApplyActionQueue();
 	}
 
-	const Vector<Signature> GameObject::Signatures()
+	void GameObject::UpdateSelf(const GameTime& time)
 	{
-		return Vector<Signature>
+		Datum& actions = Actions();
+		for (std::size_t i = 0; i < actions.Size();)
 		{
-			{ "Name", Datum::DatumType::String, 1, offsetof(GameObject, Name) },
-			{ "Position", Datum::DatumType::Vector, 1, offsetof(GameObject, Position) },
-			{ "Rotation", Datum::DatumType::Vector, 1, offsetof(GameObject, Rotation) },
-			{ "Scale", Datum::DatumType::Vector, 1, offsetof(GameObject, Scale) },
-			{ "Children", Datum::DatumType::Table, 0, 0 },
-			{ "Actions", Datum::DatumType::Table, 0, 0 }
+			Action& action = static_cast<Action&>(actions.GetTable(i));
+			if (action.Is<ActionIncrement>())
+			{
+				// Runs of increments go through the batched path; anything else still updates one by one.
+				i = ActionIncrement::UpdateRun(actions, i, time);
+			}
+			else
+			{
+				action.Update(time);
+				++i;
+			}
+		}
+	}
+
+	bool GameObject::IsSubtreeLocal(const Scope& subtreeRoot)
+	{
+		Datum& actions = Actions();
+		for (std::size_t i = 0; i < actions.Size(); ++i)
+		{
+			if (!static_cast<Action&>(actions.GetTable(i)).IsSubtreeLocal(subtreeRoot))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	gsl::span<const Signature> GameObject::Signatures()
+	{
+		static constexpr Signature signatures[]
+		{
+			SIGNATURE_OF(GameObject, Name, "Name"),
+			SIGNATURE_OF(GameObject, _position, "Position"),
+			SIGNATURE_OF(GameObject, _rotation, "Rotation"),
+			SIGNATURE_OF(GameObject, _scale, "Scale"),
+			Signature::Table("Children"),
+			Signature::Table("Actions")
 		};
+		return signatures;
 	}
 
 	gsl::owner<GameObject*> GameObject::Clone() const
@@ -108,9 +339,9 @@ namespace FieaGameEngine
 		}
 
 		return Name == rhsGameObject->Name &&
-			Position == rhsGameObject->Position &&
-			Rotation == rhsGameObject->Rotation &&
-			Scale == rhsGameObject->Scale &&
+			Position() == rhsGameObject->Position() &&
+			Rotation() == rhsGameObject->Rotation() &&
+			Scale() == rhsGameObject->Scale() &&
 			(*this)["Children"s] == (*rhsGameObject)["Children"s];
 	}
 
@@ -125,6 +356,78 @@ namespace FieaGameEngine
 		{
 			throw std::runtime_error("Cannot add nullptr action to queue.");
 		}
-		_actionQueue.PushBack(action);
+		_actionQueue.PushBack(QueuedAction{ this, action });
+	}
+
+	void GameObject::PushOnActionQueue(Scope& parent, Action& action)
+	{
+		_actionQueue.PushBack(QueuedAction{ &parent, &action });
+	}
+
+	void GameObject::PushOnDestroyQueue(Action& action)
+	{
+		for (const QueuedAction& queued : _actionQueue)
+		{
+			if (queued._parent == nullptr && queued._action == &action)
+			{
+				return;
+			}
+		}
+		_actionQueue.PushBack(QueuedAction{ nullptr, &action });
+	}
+
+	void GameObject::ApplyActionQueue()
+	{
+		if (_actionQueue.IsEmpty())
+		{
+			return;
+		}
+
+		for (const QueuedAction& queued : _actionQueue)
+		{
+			if (queued._parent != nullptr)
+			{
+				queued._parent->Adopt(*queued._action, ActionsName());
+			}
+		}
+		// Detach every doomed action before deleting any, so a list queued alongside one of its own
+		// actions does not delete that action a second time.
+		for (const QueuedAction& queued : _actionQueue)
+		{
+			Scope* parent = queued._action->GetParent();
+			if (queued._parent == nullptr && parent != nullptr)
+			{
+				parent->Orphan(*queued._action);
+			}
+		}
+		for (const QueuedAction& queued : _actionQueue)
+		{
+			if (queued._parent == nullptr)
+			{
+				delete queued._action;
+			}
+		}
+		_actionQueue.Clear();
+	}
+
+	void GameObject::DiscardActionQueue()
+	{
+		for (const QueuedAction& queued : _actionQueue)
+		{
+			if (queued._parent != nullptr)
+			{
+				delete queued._action;
+			}
+		}
+		_actionQueue.Clear();
+	}
+
+	void GameObject::BindTransform()
+	{
+		// Attributed points the transform attributes back at the members after every copy and move,
+		// so this re-points them at wherever the transform lives now.
+		PrescribedAttribute(_transformIndex).SetStorageVector(&Position(), 1);
+		PrescribedAttribute(PrescribedAttributeIndex(RotationName())).SetStorageVector(&Rotation(), 1);
+		PrescribedAttribute(PrescribedAttributeIndex(ScaleName())).SetStorageVector(&Scale(), 1);
 	}
 }
\ No newline at end of file
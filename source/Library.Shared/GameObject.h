@@ -2,6 +2,7 @@
 #include "Attributed.h"
 #include "Factory.h"
 #include "GameTime.h"
+#include "TransformStore.h"
 
 namespace FieaGameEngine
 {
@@ -10,6 +11,8 @@ namespace FieaGameEngine
 	/// <summary>
 	/// Concrete class with Name, Transform, and Children prescribed attributes.
 	/// Used for describing a scene hierarchy.
+	/// The Position, Rotation and Scale attributes live in the object itself unless it is bound to a
+	/// TransformStore, in which case they live in the store's slot and the attributes point there.
 	/// </summary>
 	class GameObject : public Attributed
 	{
@@ -23,34 +26,70 @@ namespace FieaGameEngine
 		GameObject();
 
 		/// <summary>
-		/// Defaulted copy constructor.
+		/// Constructs a GameObject whose transform lives in a slot of given store.
 		/// </summary>
-		GameObject(const GameObject& other) = default;
+		explicit GameObject(TransformStore& store);
 
 		/// <summary>
-		/// Defaulted copy assignment operator.
+		/// Copy constructor. A copy of a store bound object takes its own slot in the same store.
 		/// </summary>
-		GameObject& operator=(const GameObject& other) = default;
+		GameObject(const GameObject& other);
 
 		/// <summary>
-		/// Defaulted move constructor.
+		/// Copy assignment operator. Copies transform values, but keeps this object's own binding.
 		/// </summary>
-		GameObject(GameObject&& other) noexcept = default;
+		GameObject& operator=(const GameObject& other);
 
 		/// <summary>
-		/// Defaulted move assignment operator.
+		/// Move constructor. Takes over other's store slot, leaving other unbound.
 		/// </summary>
-		GameObject& operator=(GameObject&& other) noexcept = default;
+		GameObject(GameObject&& other) noexcept;
 
 		/// <summary>
-		/// Destructor. Does no work.
+		/// Move assignment operator. Releases this object's slot and takes over other's.
+		/// </summary>
+		GameObject& operator=(GameObject&& other) noexcept;
+
+		/// <summary>
+		/// Destructor. Returns the transform slot to its store, if bound to one.
 		/// </summary>
 		virtual ~GameObject() override;
 
 		std::string Name;
-		glm::vec4 Position;
-		glm::vec4 Rotation;
-		glm::vec4 Scale;
+
+		/// <summary>
+		/// Returns position, held in the transform store slot if bound to one.
+		/// </summary>
+		glm::vec4& Position();
+		const glm::vec4& Position() const;
+
+		/// <summary>
+		/// Returns rotation, held in the transform store slot if bound to one.
+		/// </summary>
+		glm::vec4& Rotation();
+		const glm::vec4& Rotation() const;
+
+		/// <summary>
+		/// Returns scale, held in the transform store slot if bound to one.
+		/// </summary>
+		glm::vec4& Scale();
+		const glm::vec4& Scale() const;
+
+		/// <summary>
+		/// Moves the transform into a slot of given store, or back into this object if nullptr.
+		/// Values are kept, and the Position, Rotation and Scale attributes are rebound to the new location.
+		/// </summary>
+		void SetTransformStore(TransformStore* store);
+
+		/// <summary>
+		/// Returns the store holding this object's transform, nullptr if it is held by the object itself.
+		/// </summary>
+		TransformStore* GetTransformStore() const;
+
+		/// <summary>
+		/// Returns handle of this object's slot in its transform store, InvalidHandle if unbound.
+		/// </summary>
+		TransformStore::Handle TransformHandle() const;
 
 		/// <summary>
 		/// Returns datum holding the children of this GameObject.
@@ -78,14 +117,30 @@ namespace FieaGameEngine
 		Action& GetAction(std::size_t index = 0);
 
 		/// <summary>
-		/// Calls update on all children.
+		/// Updates all children, then this object through UpdateSelf, recursively. Actions created or
+		/// destroyed through the action queues are applied in one batch once the whole subtree has
+		/// been updated, so none of them show up partway through the walk.
 		/// </summary>
 		virtual void Update(const GameTime& time);
+
+		/// <summary>
+		/// Updates this object alone, without its children. Runs each of its actions in order.
+		/// GameState calls this directly when it walks the flattened hierarchy, so per object
+		/// behavior belongs in overrides of this rather than Update.
+		/// </summary>
+		virtual void UpdateSelf(const GameTime& time);
+
+		/// <summary>
+		/// Returns whether UpdateSelf touches nothing outside given subtree and leaves the hierarchy's
+		/// structure alone, which holds when every action of this object is local to it. Overrides of
+		/// UpdateSelf that reach further must override this as well.
+		/// </summary>
+		virtual bool IsSubtreeLocal(const Scope& subtreeRoot);
 		
 		/// <summary>
 		/// Returns the signatures of each data member for this class.
 		/// </summary>
-		static const Vector<Signature> Signatures();
+		static gsl::span<const Signature> Signatures();
 
 		/// <summary>
 		/// Creates a heap allocated copy of this class.
@@ -104,12 +159,57 @@ namespace FieaGameEngine
 		std::string ToString() const override;
 
 		/// <summary>
-		/// Adds the action to the action queue.
+		/// Queues given action to be adopted into this object's Actions by ApplyActionQueue.
+		/// This object owns the action until then. Throws if action is nullptr.
 		/// </summary>
 		void PushOnActionQueue(Action* action);
 
+		/// <summary>
+		/// Queues given action to be adopted into the Actions of parent, which must be this object or
+		/// an ActionList within it, by ApplyActionQueue. This object owns the action until then.
+		/// </summary>
+		void PushOnActionQueue(Scope& parent, Action& action);
+
+		/// <summary>
+		/// Queues given action, which must be within this object, to be orphaned and deleted by
+		/// ApplyActionQueue. Queuing the same action twice destroys it once.
+		/// </summary>
+		void PushOnDestroyQueue(Action& action);
+
+		/// <summary>
+		/// Adopts every queued action, then destroys every action queued for destruction, and empties
+		/// the queue. Adopting first means an action created inside a list destroyed in the same
+		/// frame is destroyed along with it. GameObject::Update and GameState call this for every
+		/// object they updated at the end of a frame.
+		/// </summary>
+		void ApplyActionQueue();
+
 	protected:
-		Vector<Action*> _actionQueue;
+		/// <summary>
+		/// Structural change waiting for ApplyActionQueue. A null _parent marks a destruction.
+		/// </summary>
+		struct QueuedAction final
+		{
+			Scope* _parent;
+			Action* _action;
+		};
+
+		Vector<QueuedAction> _actionQueue;
+
+	private:
+		void BindTransform();
+		void UpdateSubtree(const GameTime& time);
+		void ApplySubtreeActionQueues();
+		void DiscardActionQueue();
+
+		glm::vec4 _position;
+		glm::vec4 _rotation;
+		glm::vec4 _scale;
+		TransformStore* _transformStore{ nullptr };
+		TransformStore::Handle _transformHandle{ TransformStore::InvalidHandle };
+		std::size_t _childrenIndex;
+		std::size_t _actionsIndex;
+		std::size_t _transformIndex;
 	};
 
 	ConcreteFactory(GameObject, RTTI)
@@ -3,13 +3,166 @@
 
 namespace FieaGameEngine
 {
+	GameState::GameState(GameObject* sceneRoot) :
+		_sceneRoot(sceneRoot)
+	{
+	}
+
+	void GameState::SetSceneRoot(GameObject* sceneRoot)
+	{
+		_sceneRoot = sceneRoot;
+		_updateOrderGeneration = InvalidGeneration;
+	}
+
+	GameObject* GameState::SceneRoot() const
+	{
+		return _sceneRoot;
+	}
+
 	void GameState::Update(GameTime time)
 	{
-		_sceneRoot->Update(time);
+		if (_updateOrderGeneration != Scope::HierarchyGeneration())
+		{
+			RebuildUpdateOrder();
+		}
+		UpdateSerially(time, 0);
+		ApplyActionQueues();
+	}
+
+	void GameState::Update(GameTime time, JobSystem& jobs)
+	{
+		if (_updateOrderGeneration != Scope::HierarchyGeneration())
+		{
+			RebuildUpdateOrder();
+		}
+
+		std::size_t next = 0;
+		while (next < _subtrees.Size())
+		{
+			if (IsLocal(_subtrees[next]))
+			{
+				std::size_t end = next + 1;
+				while (end < _subtrees.Size() && IsLocal(_subtrees[end]))
+				{
+					++end;
+				}
+
+				jobs.ParallelFor(end - next, [this, next, &time](std::size_t index)
+				{
+					const Subtree& subtree = _subtrees[next + index];
+					for (std::size_t i = subtree._begin; i < subtree._end; ++i)
+					{
+						_updateOrder[i]->UpdateSelf(time);
+					}
+				});
+				if (_updateOrderGeneration != Scope::HierarchyGeneration())
+				{
+					// An object declared local changed the hierarchy of its own subtree anyway.
+					FinishSerially(time, *_updateOrder[_subtrees[end - 1]._end - 1]);
+					return;
+				}
+				next = end;
+			}
+			else
+			{
+				const Subtree& subtree = _subtrees[next];
+				for (std::size_t i = subtree._begin; i < subtree._end; ++i)
+				{
+					GameObject* gameObject = _updateOrder[i];
+					gameObject->UpdateSelf(time);
+					if (_updateOrderGeneration != Scope::HierarchyGeneration())
+					{
+						FinishSerially(time, *gameObject);
+						return;
+					}
+				}
+				++next;
+			}
+		}
+
+		if (!_updateOrder.IsEmpty())
+		{
+			_updateOrder.Back()->UpdateSelf(time);
+		}
+		ApplyActionQueues();
+	}
+
+	void GameState::UpdateSerially(const GameTime& time, std::size_t begin)
+	{
+		for (std::size_t i = begin; i < _updateOrder.Size(); ++i)
+		{
+			GameObject* gameObject = _updateOrder[i];
+			gameObject->UpdateSelf(time);
+			if (_updateOrderGeneration != Scope::HierarchyGeneration())
+			{
+				RebuildUpdateOrder();
+				i = _updateOrder.IndexOf(gameObject);
+			}
+		}
+	}
+
+	void GameState::FinishSerially(const GameTime& time, GameObject& last)
+	{
+		// The rebuilt plan no longer matches the batches, so the rest of the frame runs serially.
+		RebuildUpdateOrder();
+		UpdateSerially(time, _updateOrder.IndexOf(&last) + 1);
+		ApplyActionQueues();
+	}
+
+	void GameState::ApplyActionQueues()
+	{
+		// Applying only touches Actions, so the objects in the array all stay alive.
+		for (GameObject* gameObject : _updateOrder)
+		{
+			gameObject->ApplyActionQueue();
+		}
+	}
+
+	void GameState::RebuildUpdateOrder()
+	{
+		_updateOrder.Clear();
+		_subtrees.Clear();
+		_updateOrderGeneration = Scope::HierarchyGeneration();
+		if (_sceneRoot == nullptr)
+		{
+			return;
+		}
+
+		// Post order walk with an explicit stack of (object, next child to visit).
+		Vector<std::pair<GameObject*, std::size_t>> stack;
+		stack.PushBack(std::make_pair(_sceneRoot, std::size_t(0)));
+		while (!stack.IsEmpty())
+		{
+			auto& [gameObject, nextChild] = stack.Back();
+			Datum& children = gameObject->Children();
+			if (nextChild < children.Size())
+			{
+				GameObject& child = static_cast<GameObject&>(children.GetTable(nextChild++));
+				stack.PushBack(std::make_pair(&child, std::size_t(0)));
+			}
+			else
+			{
+				_updateOrder.PushBack(gameObject);
+				stack.PopBack();
+				if (stack.Size() == 1)
+				{
+					const std::size_t begin = _subtrees.IsEmpty() ? 0 : _subtrees.Back()._end;
+					_subtrees.PushBack(Subtree{ begin, _updateOrder.Size() });
+				}
+			}
+		}
 	}
 
-	void GameState::EnqueueAction(Action* action)
+	bool GameState::IsLocal(const Subtree& subtree) const
 	{
-		_actionsQueue.PushBack(action);
+		GameObject& subtreeRoot = *_updateOrder[subtree._end - 1];
+		for (std::size_t i = subtree._begin; i < subtree._end; ++i)
+		{
+			if (!_updateOrder[i]->IsSubtreeLocal(subtreeRoot))
+			{
+				return false;
+			}
+		}
+		return true;
 	}
 }
\ No newline at end of file
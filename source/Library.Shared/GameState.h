@@ -1,19 +1,90 @@
 #pragma once
+#include <limits>
 #include "GameTime.h"
 #include "Action.h"
 #include "Vector.h"
 #include "GameObject.h"
+#include "JobSystem.h"
 
 namespace FieaGameEngine
 {
+	/// <summary>
+	/// Owns the per frame update of a scene hierarchy.
+	/// </summary>
 	class GameState final
 	{
 	public:
+		/// <summary>
+		/// Constructs a GameState that updates the hierarchy under given root.
+		/// </summary>
+		explicit GameState(GameObject* sceneRoot = nullptr);
+
+		/// <summary>
+		/// Sets the root of the hierarchy to update. Does not take ownership.
+		/// </summary>
+		void SetSceneRoot(GameObject* sceneRoot);
+
+		/// <summary>
+		/// Returns the root of the hierarchy to update, nullptr if none.
+		/// </summary>
+		GameObject* SceneRoot() const;
+
+		/// <summary>
+		/// Updates every GameObject under the scene root, in the same order as GameObject::Update:
+		/// children before their parent, siblings in order. Walks a flattened depth first array
+		/// instead of recursing, rebuilding it only when Scope::HierarchyGeneration changes.
+		/// If an update changes the hierarchy, the walk resumes after the current object in the
+		/// rebuilt array, so objects added to subtrees not yet visited are updated this frame.
+		/// Actions created or destroyed through the GameObject action queues are applied in one
+		/// batch once every object has been updated.
+		/// </summary>
 		void Update(GameTime time);
-		void EnqueueAction(Action* action);
+
+		/// <summary>
+		/// Updates the same objects as Update, running sibling subtrees under the scene root as jobs.
+		/// A child of the root and its descendants form one job, updated in order on one thread.
+		/// Runs of consecutive children whose objects are all IsSubtreeLocal go out as one parallel
+		/// batch; any other child is updated alone between batches, so it still observes every sibling
+		/// before it and none after it, exactly as in Update. Action creation and destruction go through
+		/// the per object queues, so only direct structural changes force a subtree to run serially.
+		/// The root updates last, then the queues are applied as in Update.
+		/// Locality is worked out as the dispatch reaches each child, never cached across frames or
+		/// batches, since retargeting an action or appending a same named attribute nearer the root
+		/// changes it without changing the hierarchy. If a batch changes the hierarchy anyway, the
+		/// array is rebuilt and the frame finishes serially after the batch.
+		/// </summary>
+		void Update(GameTime time, JobSystem& jobs);
 
 	private:
+		/// <summary>
+		/// Range of the flattened array holding one child of the root and its descendants.
+		/// </summary>
+		struct Subtree final
+		{
+			std::size_t _begin;
+			std::size_t _end;
+		};
+
+		void RebuildUpdateOrder();
+
+		/// <summary>
+		/// Returns whether every object of given subtree only touches objects inside it.
+		/// </summary>
+		bool IsLocal(const Subtree& subtree) const;
+		void UpdateSerially(const GameTime& time, std::size_t begin);
+
+		/// <summary>
+		/// Rebuilds the flattened array after the hierarchy changed mid frame, then updates every object
+		/// after given one, already updated, and applies the queues.
+		/// </summary>
+		void FinishSerially(const GameTime& time, GameObject& last);
+		void ApplyActionQueues();
+
+		static constexpr std::size_t InvalidGeneration = std::numeric_limits<std::size_t>::max();
+
 		GameObject* _sceneRoot;
-		Vector<Action*> _actionsQueue;
+		Vector<GameObject*> _updateOrder;
+		Vector<Subtree> _subtrees;
+		std::size_t _updateOrderGeneration{ InvalidGeneration };
 	};
 }
\ No newline at end of file
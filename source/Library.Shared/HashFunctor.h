@@ -1,27 +1,130 @@
 #pragma once
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
 #include "RTTI.h"
 
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
 namespace FieaGameEngine
 {
 	template<typename T>
 	struct HashBase
 	{
 		/// <summary>
-		/// Performs an additive hash on the given byte data.
+		/// Hashes the given byte data with a wyhash style multiply-mix. Every input byte affects every output 
+		/// bit, so anagrams and keys sharing a prefix spread across buckets. Inputs of 16 bytes or fewer, which 
+		/// covers most attribute names, are read as two overlapping word loads with no per-byte loop.
 		/// </summary>
 		/// <param name="data">Pointer to start of byte data in memory.</param>
 		/// <param name="size">Size of the object to hash.</param>
 		/// <returns>Unsigned int.</returns>
-		inline std::size_t AdditiveHash(const std::uint8_t* data, std::size_t size)
+		inline std::size_t ByteHash(const std::uint8_t* data, std::size_t size) const
 		{
-			std::size_t hash = 11;
+			const std::uint8_t* p = data;
+			std::uint64_t seed = Mix(Secret[0], Secret[1]);
+			std::uint64_t a;
+			std::uint64_t b;
 
-			for (std::size_t i = 0; i < size; ++i)
+			if (size <= 16)
+			{
+				if (size >= 4)
+				{
+					const std::size_t middle = (size >> 3) << 2;
+					a = (Read4(p) << 32) | Read4(p + middle);
+					b = (Read4(p + size - 4) << 32) | Read4(p + size - 4 - middle);
+				}
+				else if (size > 0)
+				{
+					a = (std::uint64_t(p[0]) << 16) | (std::uint64_t(p[size >> 1]) << 8) | p[size - 1];
+					b = 0;
+				}
+				else
+				{
+					a = b = 0;
+				}
+			}
+			else
 			{
-				hash += data[i];
+				std::size_t remaining = size;
+				if (remaining > 48)
+				{
+					std::uint64_t seed1 = seed;
+					std::uint64_t seed2 = seed;
+					do
+					{
+						seed = Mix(Read8(p) ^ Secret[1], Read8(p + 8) ^ seed);
+						seed1 = Mix(Read8(p + 16) ^ Secret[2], Read8(p + 24) ^ seed1);
+						seed2 = Mix(Read8(p + 32) ^ Secret[3], Read8(p + 40) ^ seed2);
+						p += 48;
+						remaining -= 48;
+					} while (remaining > 48);
+					seed ^= seed1 ^ seed2;
+				}
+				while (remaining > 16)
+				{
+					seed = Mix(Read8(p) ^ Secret[1], Read8(p + 8) ^ seed);
+					p += 16;
+					remaining -= 16;
+				}
+				a = Read8(p + remaining - 16);
+				b = Read8(p + remaining - 8);
 			}
-			return hash;
+
+			a ^= Secret[1];
+			b ^= seed;
+			Multiply(a, b);
+			return static_cast<std::size_t>(Mix(a ^ Secret[0] ^ size, b ^ Secret[1]));
+		}
+
+	private:
+		inline static const std::uint64_t Secret[4] = 
+		{ 
+			0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull 
+		};
+
+		static inline std::uint64_t Read8(const std::uint8_t* p)
+		{
+			std::uint64_t value;
+			std::memcpy(&value, p, sizeof(value));
+			return value;
+		}
+
+		static inline std::uint64_t Read4(const std::uint8_t* p)
+		{
+			std::uint32_t value;
+			std::memcpy(&value, p, sizeof(value));
+			return value;
+		}
+
+		/// <summary>
+		/// Full 64x64 bit multiply, leaving the low half in a and the high half in b.
+		/// </summary>
+		static inline void Multiply(std::uint64_t& a, std::uint64_t& b)
+		{
+#if defined(_MSC_VER) && defined(_M_X64)
+			a = _umul128(a, b, &b);
+#elif defined(__SIZEOF_INT128__)
+			unsigned __int128 result = static_cast<unsigned __int128>(a) * b;
+			a = static_cast<std::uint64_t>(result);
+			b = static_cast<std::uint64_t>(result >> 64);
+#else
+			const std::uint64_t aHigh = a >> 32, aLow = static_cast<std::uint32_t>(a);
+			const std::uint64_t bHigh = b >> 32, bLow = static_cast<std::uint32_t>(b);
+			const std::uint64_t high = aHigh * bHigh, middle0 = aHigh * bLow, middle1 = aLow * bHigh, low = aLow * bLow;
+			const std::uint64_t carry = (low >> 32) + static_cast<std::uint32_t>(middle0) + static_cast<std::uint32_t>(middle1);
+			a = (carry << 32) | static_cast<std::uint32_t>(low);
+			b = high + (middle0 >> 32) + (middle1 >> 32) + (carry >> 32);
+#endif
+		}
+
+		static inline std::uint64_t Mix(std::uint64_t a, std::uint64_t b)
+		{
+			Multiply(a, b);
+			return a ^ b;
 		}
 	};
 
@@ -35,9 +138,9 @@ namespace FieaGameEngine
 		/// <summary>
 		/// Produces random unsigned int from given key.
 		/// </summary>
-		std::size_t operator()(const T& key)
+		std::size_t operator()(const T& key) const
 		{
-			return AdditiveHash(reinterpret_cast<std::uint8_t*>(&key), sizeof(T));
+			return this->ByteHash(reinterpret_cast<const std::uint8_t*>(&key), sizeof(T));
 		}
 	};
 
@@ -47,7 +150,7 @@ namespace FieaGameEngine
 	template<>
 	struct HashFunctor<RTTI::IdType> : HashBase<RTTI::IdType>
 	{
-		std::size_t operator()(const RTTI::IdType& key)
+		std::size_t operator()(const RTTI::IdType& key) const
 		{
 			return key;
 		}
@@ -59,9 +162,9 @@ namespace FieaGameEngine
 	template<>
 	struct HashFunctor<std::string> : HashBase<std::string>
 	{
-		std::size_t operator()(const std::string& key)
+		std::size_t operator()(const std::string& key) const
 		{
-			return AdditiveHash(reinterpret_cast<const std::uint8_t*>(key.c_str()), key.size());
+			return ByteHash(reinterpret_cast<const std::uint8_t*>(key.c_str()), key.size());
 		}
 	};
 
@@ -71,9 +174,9 @@ namespace FieaGameEngine
 	template<>
 	struct HashFunctor<const std::string> : HashBase<const std::string>
 	{
-		std::size_t operator()(const std::string& key)
+		std::size_t operator()(const std::string& key) const
 		{
-			return AdditiveHash(reinterpret_cast<const std::uint8_t*>(key.c_str()), key.size());
+			return ByteHash(reinterpret_cast<const std::uint8_t*>(key.c_str()), key.size());
 		}
 	};
 
@@ -83,9 +186,9 @@ namespace FieaGameEngine
 	template<>
 	struct HashFunctor<char*> : HashBase<char*>
 	{
-		std::size_t operator()(char* key)
+		std::size_t operator()(char* key) const
 		{
-			return AdditiveHash(reinterpret_cast<const std::uint8_t*>(key), strlen(key));
+			return ByteHash(reinterpret_cast<const std::uint8_t*>(key), strlen(key));
 		}
 	};
 
@@ -95,9 +198,9 @@ namespace FieaGameEngine
 	template<>
 	struct HashFunctor<const char*> : HashBase<const char*>
 	{
-		std::size_t operator()(const char* key)
+		std::size_t operator()(const char* key) const
 		{
-			return AdditiveHash(reinterpret_cast<const std::uint8_t*>(key), strlen(key));
+			return ByteHash(reinterpret_cast<const std::uint8_t*>(key), strlen(key));
 		}
 	};
 }
\ No newline at end of file
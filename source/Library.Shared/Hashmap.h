@@ -3,13 +3,20 @@
 #include <stdexcept>
 #include <functional>
 #include <cassert>
+#include <cmath>
+#include <algorithm>
 #include "SList.h"
 #include "Vector.h"
 #include "HashFunctor.h"
 
 namespace FieaGameEngine
 {
-	template<typename TKey, typename TData>
+	/// <summary>
+	/// Chained hashmap. Hashing and key comparison are compile time policies, so lookups call them directly.
+	/// </summary>
+	/// <typeparam name="THash">Default constructible functor mapping a key to a size_t.</typeparam>
+	/// <typeparam name="TEqual">Default constructible functor comparing two keys.</typeparam>
+	template<typename TKey, typename TData, typename THash = HashFunctor<TKey>, typename TEqual = std::equal_to<TKey>>
 	class Hashmap final
 	{
 	public:
@@ -170,8 +177,7 @@ namespace FieaGameEngine
 		/// <param name="HashFunction">Function for generating index for any key.</param>
 		/// <param name="EqualityFunction">Function for determining equality between keys.</param>
 		explicit Hashmap(std::size_t bucketCount = 11, 
-			std::function<std::size_t(const TKey&)> hashFunction = HashFunctor<TKey>{},
-			std::function<bool(const TKey&, const TKey&)> equalityFunction = std::equal_to<TKey>{});
+			const THash& hashFunction = THash{}, const TEqual& equalityFunction = TEqual{});
 
 		/// <summary>
 		/// Constructor that takes an initializer list of pair entries.
@@ -179,13 +185,12 @@ namespace FieaGameEngine
 		/// <param name="HashFunction">Function for generating index for any key.</param>
 		/// <param name="EqualityFunction">Function for determining equality between keys.</param>
 		explicit Hashmap(std::initializer_list<pair_type> list, 
-			std::function<std::size_t(const TKey&)> hashFunction = HashFunctor<TKey>{},
-			std::function<bool(const TKey&, const TKey&)> equalityFunction = std::equal_to<TKey>{});
+			const THash& hashFunction = THash{}, const TEqual& equalityFunction = TEqual{});
 
 		/// <summary>
-		/// Copy constructor, produces Hashmap from given Hashmap instance.
+		/// Copy constructor, produces Hashmap from given Hashmap instance. The copy gets its own node pool.
 		/// </summary>
-		Hashmap(const Hashmap& other) = default;
+		Hashmap(const Hashmap& other);
 
 		/// <summary>
 		/// Move constructor, produces Hashmap from given R value Hashmap, then zeroes out given map.
@@ -194,9 +199,9 @@ namespace FieaGameEngine
 		Hashmap(Hashmap&& other) noexcept = default;
 
 		/// <summary>
-		/// Copy assignment operator, sets lhs equal to given rhs Hashmap.
+		/// Copy assignment operator, sets lhs equal to given rhs Hashmap. The copy gets its own node pool.
 		/// </summary>
-		Hashmap& operator=(const Hashmap& other) = default;
+		Hashmap& operator=(const Hashmap& other);
 
 		/// <summary>
 		/// Move assignment operator, sets lhs L value equal to rhs R value, then zeroes out rhs.
@@ -263,6 +268,30 @@ namespace FieaGameEngine
 		/// </summary>
 		float LoadFactor() const;
 
+		/// <summary>
+		/// Load factor above which an insert grows the bucket count.
+		/// </summary>
+		float MaxLoadFactor() const;
+
+		/// <summary>
+		/// Sets the load factor above which an insert grows the bucket count.
+		/// Rehashes immediately if the current load factor already exceeds it.
+		/// </summary>
+		void SetMaxLoadFactor(float maxLoadFactor);
+
+		/// <summary>
+		/// Redistributes entries into at least the given number of buckets, never fewer than 
+		/// the current size allows under the max load factor. Chain nodes are relinked rather than 
+		/// copied, so references to entries stay valid. Invalidates all Iterators.
+		/// </summary>
+		void Rehash(std::size_t bucketCount);
+
+		/// <summary>
+		/// Grows the bucket count so the given number of entries can be held without further rehashing,
+		/// and preallocates chain nodes for them.
+		/// </summary>
+		void Reserve(std::size_t entryCount);
+
 		/// <summary>
 		/// Returns whether given key exists in this map.
 		/// </summary>
@@ -299,10 +328,19 @@ namespace FieaGameEngine
 		ConstIterator cend() const;
 
 	private:
+		std::size_t BucketsFor(std::size_t entryCount) const;
+		void CreateBuckets(map_type& map, std::size_t bucketCount);
+
+		/// <summary>
+		/// Chains take their nodes from this pool, so insert/remove churn recycles nodes instead of
+		/// going to the global heap, and rehashing can relink nodes between chains.
+		/// </summary>
+		std::shared_ptr<typename chain_type::NodePool> _nodePool{ std::make_shared<typename chain_type::NodePool>() };
 		map_type _map{ };
-		std::function<std::size_t(const TKey&)> _hashFunction;
-		std::function<bool(const TKey&, const TKey&)> _equalityFunction;
+		THash _hashFunction;
+		TEqual _equalityFunction;
 		std::size_t _size{ 0 };
+		float _maxLoadFactor{ 1.0f };
 	};
 }
 
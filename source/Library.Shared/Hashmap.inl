@@ -2,21 +2,21 @@
 
 namespace FieaGameEngine
 {
-	template<typename TKey, typename TData>
-	Hashmap<TKey, TData>::Iterator::Iterator(Hashmap& owner, 
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	Hashmap<TKey, TData, THash, TEqual>::Iterator::Iterator(Hashmap& owner, 
 		typename map_type::Iterator bucketIt, typename chain_type::Iterator chainIt) :
 		owner(&owner), bucketIt(bucketIt), chainIt(chainIt)
 	{
 	}
 
-	template<typename TKey, typename TData>
-	bool Hashmap<TKey, TData>::Iterator::operator==(const Iterator& rhs) const
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	bool Hashmap<TKey, TData, THash, TEqual>::Iterator::operator==(const Iterator& rhs) const
 	{
 		return !operator!=(rhs);
 	}
 
-	template<typename TKey, typename TData>
-	bool Hashmap<TKey, TData>::Iterator::operator!=(const Iterator& rhs) const
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	bool Hashmap<TKey, TData, THash, TEqual>::Iterator::operator!=(const Iterator& rhs) const
 	{
 		bool result = true;
 		if (owner == rhs.owner && bucketIt == rhs.bucketIt &&
@@ -27,8 +27,8 @@ namespace FieaGameEngine
 		return result;
 	}
 
-	template<typename TKey, typename TData>
-	typename Hashmap<TKey, TData>::Iterator& Hashmap<TKey, TData>::Iterator::operator++()
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	typename Hashmap<TKey, TData, THash, TEqual>::Iterator& Hashmap<TKey, TData, THash, TEqual>::Iterator::operator++()
 	{
 		if (owner == nullptr)
 		{
@@ -55,16 +55,16 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template<typename TKey, typename TData>
-	typename Hashmap<TKey, TData>::Iterator Hashmap<TKey, TData>::Iterator::operator++(int)
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	typename Hashmap<TKey, TData, THash, TEqual>::Iterator Hashmap<TKey, TData, THash, TEqual>::Iterator::operator++(int)
 	{
 		Iterator temp = *this;
 		++(*this);
 		return temp;
 	}
 
-	template<typename TKey, typename TData>
-	inline typename Hashmap<TKey, TData>::pair_type& Hashmap<TKey, TData>::Iterator::operator*() const
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	inline typename Hashmap<TKey, TData, THash, TEqual>::pair_type& Hashmap<TKey, TData, THash, TEqual>::Iterator::operator*() const
 	{
 		if (owner == nullptr)
 		{
@@ -74,27 +74,27 @@ namespace FieaGameEngine
 		return *chainIt;
 	}
 
-	template<typename TKey, typename TData>
-	Hashmap<TKey, TData>::ConstIterator::ConstIterator(const Hashmap& owner, 
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	Hashmap<TKey, TData, THash, TEqual>::ConstIterator::ConstIterator(const Hashmap& owner, 
 		typename map_type::ConstIterator bucketIt, typename chain_type::ConstIterator chainIt) :
 		owner(&owner), bucketIt(bucketIt), chainIt(chainIt)
 	{
 	}
 
-	template<typename TKey, typename TData>
-	Hashmap<TKey, TData>::ConstIterator::ConstIterator(const Iterator& other) :
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	Hashmap<TKey, TData, THash, TEqual>::ConstIterator::ConstIterator(const Iterator& other) :
 		owner(other.owner), bucketIt(other.bucketIt), chainIt(other.chainIt)
 	{
 	}
 
-	template<typename TKey, typename TData>
-	bool Hashmap<TKey, TData>::ConstIterator::operator==(const ConstIterator& rhs) const
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	bool Hashmap<TKey, TData, THash, TEqual>::ConstIterator::operator==(const ConstIterator& rhs) const
 	{
 		return !operator!=(rhs);
 	}
 
-	template<typename TKey, typename TData>
-	bool Hashmap<TKey, TData>::ConstIterator::operator!=(const ConstIterator& rhs) const
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	bool Hashmap<TKey, TData, THash, TEqual>::ConstIterator::operator!=(const ConstIterator& rhs) const
 	{
 		bool result = true;
 		if (owner == rhs.owner && bucketIt == rhs.bucketIt && 
@@ -105,8 +105,8 @@ namespace FieaGameEngine
 		return result;
 	}
 
-	template<typename TKey, typename TData>
-	typename Hashmap<TKey, TData>::ConstIterator& Hashmap<TKey, TData>::ConstIterator::operator++()
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	typename Hashmap<TKey, TData, THash, TEqual>::ConstIterator& Hashmap<TKey, TData, THash, TEqual>::ConstIterator::operator++()
 	{
 		if (owner == nullptr)
 		{
@@ -133,16 +133,16 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template<typename TKey, typename TData>
-	typename Hashmap<TKey, TData>::ConstIterator Hashmap<TKey, TData>::ConstIterator::operator++(int)
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	typename Hashmap<TKey, TData, THash, TEqual>::ConstIterator Hashmap<TKey, TData, THash, TEqual>::ConstIterator::operator++(int)
 	{
 		ConstIterator temp = *this;
 		++(*this);
 		return temp;
 	}
 
-	template<typename TKey, typename TData>
-	inline const typename Hashmap<TKey, TData>::pair_type& Hashmap<TKey, TData>::ConstIterator::operator*() const
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	inline const typename Hashmap<TKey, TData, THash, TEqual>::pair_type& Hashmap<TKey, TData, THash, TEqual>::ConstIterator::operator*() const
 	{
 		if (owner == nullptr)
 		{
@@ -152,10 +152,9 @@ namespace FieaGameEngine
 		return *chainIt;
 	}
 
-	template<typename TKey, typename TData>
-	Hashmap<TKey,TData>::Hashmap(std::size_t bucketCount, 
-		std::function<std::size_t(const TKey&)> hashFunction,
-		std::function<bool(const TKey&, const TKey&)> equalityFunction) :
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	Hashmap<TKey, TData, THash, TEqual>::Hashmap(std::size_t bucketCount, 
+		const THash& hashFunction, const TEqual& equalityFunction) :
 		_map(bucketCount), _hashFunction(hashFunction), _equalityFunction(equalityFunction)
 	{
 		if (bucketCount < 2)
@@ -163,16 +162,15 @@ namespace FieaGameEngine
 			throw std::runtime_error("bucketCount cannot be less than 2.");
 		}
 
-		_map.Resize(bucketCount);
+		CreateBuckets(_map, bucketCount);
 	}
 
-	template<typename TKey, typename TData>
-	Hashmap<TKey, TData>::Hashmap(std::initializer_list<pair_type> list,
-		std::function<std::size_t(const TKey&)> hashFunction,
-		std::function<bool(const TKey&, const TKey&)> equalityFunction) :
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	Hashmap<TKey, TData, THash, TEqual>::Hashmap(std::initializer_list<pair_type> list,
+		const THash& hashFunction, const TEqual& equalityFunction) :
 		_map(list.size()), _hashFunction(hashFunction), _equalityFunction(equalityFunction)
 	{
-		_map.Resize(list.size());
+		CreateBuckets(_map, list.size());
 
 		for (auto& pair : list)
 		{
@@ -180,8 +178,34 @@ namespace FieaGameEngine
 		}
 	}
 
-	template<typename TKey, typename TData>
-	typename Hashmap<TKey, TData>::Iterator Hashmap<TKey, TData>::Find(const TKey& key)
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	Hashmap<TKey, TData, THash, TEqual>::Hashmap(const Hashmap& other) :
+		_map(other._map.Size()), _hashFunction(other._hashFunction), _equalityFunction(other._equalityFunction),
+		_size(other._size), _maxLoadFactor(other._maxLoadFactor)
+	{
+		CreateBuckets(_map, other._map.Size());
+		for (std::size_t i = 0; i < other._map.Size(); ++i)
+		{
+			for (const auto& entry : other._map[i])
+			{
+				_map[i].PushBack(entry);
+			}
+		}
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	Hashmap<TKey, TData, THash, TEqual>& Hashmap<TKey, TData, THash, TEqual>::operator=(const Hashmap& other)
+	{
+		if (this != &other)
+		{
+			Hashmap copy(other);
+			*this = std::move(copy);
+		}
+		return *this;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	typename Hashmap<TKey, TData, THash, TEqual>::Iterator Hashmap<TKey, TData, THash, TEqual>::Find(const TKey& key)
 	{
 		if (_size > 0)
 		{
@@ -200,8 +224,8 @@ namespace FieaGameEngine
 		return end();
 	}
 
-	template<typename TKey, typename TData>
-	typename Hashmap<TKey, TData>::ConstIterator Hashmap<TKey, TData>::Find(const TKey& key) const
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	typename Hashmap<TKey, TData, THash, TEqual>::ConstIterator Hashmap<TKey, TData, THash, TEqual>::Find(const TKey& key) const
 	{
 		if (_size > 0)
 		{
@@ -220,8 +244,8 @@ namespace FieaGameEngine
 		return cend();
 	}
 
-	template<typename TKey, typename TData>
-	std::pair<typename Hashmap<TKey, TData>::Iterator, bool> Hashmap<TKey, TData>::Insert(const pair_type& entry)
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	std::pair<typename Hashmap<TKey, TData, THash, TEqual>::Iterator, bool> Hashmap<TKey, TData, THash, TEqual>::Insert(const pair_type& entry)
 	{
 		bool wasInserted = false;
 
@@ -236,14 +260,21 @@ namespace FieaGameEngine
 				return std::make_pair(Iterator(*this, _map.At(index), chainIt), wasInserted);
 			}
 		}
-		chainIt = chain.PushBack(std::pair(entry.first, entry.second));
+
+		if (_size + 1 > _maxLoadFactor * _map.Size())
+		{
+			Rehash(_map.Size() * 2 + 1);
+			index = _hashFunction(entry.first) % _map.Size();
+		}
+
+		chainIt = _map[index].PushBack(std::pair(entry.first, entry.second));
 		++_size;
 		wasInserted = true;
 		return std::make_pair(Iterator(*this, _map.At(index), chainIt), wasInserted);
 	}
 
-	template<typename TKey, typename TData>
-	TData& Hashmap<TKey, TData>::operator[](const TKey& key)
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	TData& Hashmap<TKey, TData, THash, TEqual>::operator[](const TKey& key)
 	{
 		Iterator it = Find(key);
 		if (it != end())
@@ -256,8 +287,8 @@ namespace FieaGameEngine
 		}
 	}
 
-	template<typename TKey, typename TData>
-	bool Hashmap<TKey, TData>::Remove(const TKey& key)
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	bool Hashmap<TKey, TData, THash, TEqual>::Remove(const TKey& key)
 	{
 		Iterator it = Find(key);
 		if (it != end())
@@ -271,15 +302,15 @@ namespace FieaGameEngine
 		}
 	}
 
-	template<typename TKey, typename TData>
-	bool Hashmap<TKey, TData>::Remove(const Iterator& it)
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	bool Hashmap<TKey, TData, THash, TEqual>::Remove(const Iterator& it)
 	{
 		it;
 		return false;
 	}
 
-	template<typename TKey, typename TData>
-	void Hashmap<TKey, TData>::Clear()
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	void Hashmap<TKey, TData, THash, TEqual>::Clear()
 	{
 		for (auto& bucket : _map)
 		{
@@ -289,52 +320,122 @@ namespace FieaGameEngine
 		_size = 0;
 	}
 
-	template<typename TKey, typename TData>
-	inline std::size_t Hashmap<TKey, TData>::Size() const
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	inline std::size_t Hashmap<TKey, TData, THash, TEqual>::Size() const
 	{
 		return _size;
 	}
 
-	template<typename TKey, typename TData>
-	inline std::size_t Hashmap<TKey, TData>::BucketCount() const
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	inline std::size_t Hashmap<TKey, TData, THash, TEqual>::BucketCount() const
+	{
+		return _map.Size();
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	inline float Hashmap<TKey, TData, THash, TEqual>::LoadFactor() const
+	{
+		return float(_size) / BucketCount();
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	inline float Hashmap<TKey, TData, THash, TEqual>::MaxLoadFactor() const
+	{
+		return _maxLoadFactor;
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	void Hashmap<TKey, TData, THash, TEqual>::SetMaxLoadFactor(float maxLoadFactor)
 	{
-		return _map.Capacity();
+		if (maxLoadFactor <= 0.0f)
+		{
+			throw std::runtime_error("Max load factor must be greater than 0.");
+		}
+
+		_maxLoadFactor = maxLoadFactor;
+		if (_size > _maxLoadFactor * _map.Size())
+		{
+			Rehash(BucketsFor(_size));
+		}
 	}
 
-	template<typename TKey, typename TData>
-	inline float Hashmap<TKey, TData>::LoadFactor() const
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	void Hashmap<TKey, TData, THash, TEqual>::Rehash(std::size_t bucketCount)
 	{
-		std::size_t filledBuckets = 0;
-		for (auto it = _map.begin(); it != _map.end(); ++it)
+		bucketCount = std::max(bucketCount, BucketsFor(_size));
+		if (bucketCount == _map.Size())
 		{
-			if ((*it).Size() > 0)
+			return;
+		}
+
+		map_type newMap(bucketCount);
+		CreateBuckets(newMap, bucketCount);
+
+		for (auto& chain : _map)
+		{
+			while (!chain.IsEmpty())
 			{
-				++filledBuckets;
+				std::size_t index = _hashFunction(chain.Front().first) % bucketCount;
+				chain.TransferFront(newMap[index]);
 			}
 		}
-		return float(filledBuckets) / BucketCount();
+
+		_map = std::move(newMap);
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	void Hashmap<TKey, TData, THash, TEqual>::Reserve(std::size_t entryCount)
+	{
+		std::size_t bucketCount = BucketsFor(entryCount);
+		if (bucketCount > _map.Size())
+		{
+			Rehash(bucketCount);
+		}
+
+		if (entryCount > _size)
+		{
+			_nodePool->Reserve(entryCount - _size);
+		}
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	void Hashmap<TKey, TData, THash, TEqual>::CreateBuckets(map_type& map, std::size_t bucketCount)
+	{
+		map.Reserve(bucketCount);
+		const chain_type emptyChain(_nodePool);
+		for (std::size_t i = 0; i < bucketCount; ++i)
+		{
+			map.PushBack(emptyChain);
+		}
+	}
+
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	inline std::size_t Hashmap<TKey, TData, THash, TEqual>::BucketsFor(std::size_t entryCount) const
+	{
+		std::size_t bucketCount = static_cast<std::size_t>(std::ceil(entryCount / _maxLoadFactor));
+		return std::max(bucketCount, std::size_t(2));
 	}
 
-	template<typename TKey, typename TData>
-	bool Hashmap<TKey, TData>::ContainsKey(const TKey& key) const
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	bool Hashmap<TKey, TData, THash, TEqual>::ContainsKey(const TKey& key) const
 	{
 		return Find(key) != cend();
 	}
 
-	template<typename TKey, typename TData>
-	TData& Hashmap<TKey, TData>::At(const TKey& key)
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	TData& Hashmap<TKey, TData, THash, TEqual>::At(const TKey& key)
 	{
 		return (*Find(key)).second;
 	}
 
-	template<typename TKey, typename TData>
-	const TData& Hashmap<TKey, TData>::At(const TKey& key) const
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	const TData& Hashmap<TKey, TData, THash, TEqual>::At(const TKey& key) const
 	{
 		return (*Find(key)).second;
 	}
 
-	template<typename TKey, typename TData>
-	typename Hashmap<TKey, TData>::Iterator Hashmap<TKey, TData>::begin()
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	typename Hashmap<TKey, TData, THash, TEqual>::Iterator Hashmap<TKey, TData, THash, TEqual>::begin()
 	{
 		if (_size == 0)
 		{
@@ -351,8 +452,8 @@ namespace FieaGameEngine
 		return Iterator(*this, bucketIt, (*bucketIt).begin());
 	}
 
-	template<typename TKey, typename TData>
-	typename Hashmap<TKey, TData>::ConstIterator Hashmap<TKey, TData>::cbegin() const
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	typename Hashmap<TKey, TData, THash, TEqual>::ConstIterator Hashmap<TKey, TData, THash, TEqual>::cbegin() const
 	{
 		if (_size == 0)
 		{
@@ -369,14 +470,14 @@ namespace FieaGameEngine
 		return ConstIterator(*this, bucketIt, (*bucketIt).cbegin());
 	}
 
-	template<typename TKey, typename TData>
-	typename Hashmap<TKey, TData>::Iterator Hashmap<TKey, TData>::end()
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	typename Hashmap<TKey, TData, THash, TEqual>::Iterator Hashmap<TKey, TData, THash, TEqual>::end()
 	{
 		return Iterator(*this, _map.end(), chain_type::Iterator());
 	}
 
-	template<typename TKey, typename TData>
-	typename Hashmap<TKey, TData>::ConstIterator Hashmap<TKey, TData>::cend() const
+	template<typename TKey, typename TData, typename THash, typename TEqual>
+	typename Hashmap<TKey, TData, THash, TEqual>::ConstIterator Hashmap<TKey, TData, THash, TEqual>::cend() const
 	{
 		return ConstIterator(*this, _map.cend(), chain_type::ConstIterator());
 	}
@@ -1,13 +1,19 @@
 #pragma once
+#include <cstddef>
+#include <algorithm>
 
 namespace FieaGameEngine
 {
+	/// <summary>
+	/// Default Vector growth policy: doubles capacity, starting from one. A growth policy is a
+	/// default constructible type whose call operator maps (size, capacity) to the new capacity.
+	/// </summary>
 	struct IncrementFunctor final
 	{
-		std::size_t operator()(std::size_t size, std::size_t capacity) const
+		constexpr std::size_t operator()(std::size_t size, std::size_t capacity) const
 		{
 			capacity;
 			return std::max(std::size_t(1), size * 2);
 		}
 	};
-}
\ No newline at end of file
+}
@@ -0,0 +1,178 @@
+#include "pch.h"
+#include "JobSystem.h"
+#include <algorithm>
+
+namespace FieaGameEngine
+{
+	namespace
+	{
+		/// <summary>
+		/// Identifies the pool and queue of the current worker thread, if it is one.
+		/// </summary>
+		thread_local const void* tlsJobSystem{ nullptr };
+		thread_local std::size_t tlsQueue{ 0 };
+
+		/// <summary>
+		/// Chunks per queue a batch is split into. More chunks balance better, fewer cost less locking.
+		/// </summary>
+		constexpr std::size_t ChunksPerQueue = 4;
+	}
+
+	std::size_t JobSystem::DefaultWorkerCount()
+	{
+		const std::size_t hardwareThreads = std::thread::hardware_concurrency();
+		return hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+	}
+
+	JobSystem::JobSystem(std::size_t workerCount) :
+		_queues(std::make_unique<Queue[]>(workerCount + 1)), _queueCount(workerCount + 1), _workers(workerCount)
+	{
+		for (std::size_t i = 0; i < workerCount; ++i)
+		{
+			_workers.EmplaceBack(&JobSystem::WorkerLoop, this, i + 1);
+		}
+	}
+
+	JobSystem::~JobSystem()
+	{
+		{
+			std::lock_guard lock(_sleepMutex);
+			_stopping = true;
+		}
+		_wake.notify_all();
+		for (std::thread& worker : _workers)
+		{
+			worker.join();
+		}
+	}
+
+	std::size_t JobSystem::WorkerCount() const
+	{
+		return _workers.Size();
+	}
+
+	void JobSystem::ParallelFor(std::size_t count, const std::function<void(std::size_t)>& job)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+
+		if (_workers.IsEmpty() || count == 1)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				job(i);
+			}
+			return;
+		}
+
+		const std::size_t chunkCount = std::min(count, _queueCount * ChunksPerQueue);
+		Batch batch{ &job, chunkCount };
+		const std::size_t own = CurrentQueue();
+		{
+			std::lock_guard lock(_sleepMutex);
+			_pending += chunkCount;
+		}
+		for (std::size_t chunk = 0; chunk < chunkCount; ++chunk)
+		{
+			Task task{ &batch, count * chunk / chunkCount, count * (chunk + 1) / chunkCount };
+			Queue& queue = _queues[(own + chunk) % _queueCount];
+			std::lock_guard lock(queue.mutex);
+			queue.tasks.push_back(task);
+		}
+		_wake.notify_all();
+
+		while (batch.remaining.load(std::memory_order_acquire) > 0)
+		{
+			if (!TryRunTask(own))
+			{
+				std::this_thread::yield();
+			}
+		}
+
+		if (batch.error != nullptr)
+		{
+			std::rethrow_exception(batch.error);
+		}
+	}
+
+	std::size_t JobSystem::CurrentQueue() const
+	{
+		return tlsJobSystem == this ? tlsQueue : 0;
+	}
+
+	bool JobSystem::TryRunTask(std::size_t queue)
+	{
+		Task task{};
+		bool found = false;
+		{
+			Queue& ownQueue = _queues[queue];
+			std::lock_guard lock(ownQueue.mutex);
+			if (!ownQueue.tasks.empty())
+			{
+				task = ownQueue.tasks.back();
+				ownQueue.tasks.pop_back();
+				found = true;
+			}
+		}
+
+		for (std::size_t offset = 1; !found && offset < _queueCount; ++offset)
+		{
+			Queue& victim = _queues[(queue + offset) % _queueCount];
+			std::lock_guard lock(victim.mutex);
+			if (!victim.tasks.empty())
+			{
+				task = victim.tasks.front();
+				victim.tasks.pop_front();
+				found = true;
+			}
+		}
+
+		if (!found)
+		{
+			return false;
+		}
+
+		--_pending;
+		Batch& batch = *task.batch;
+		try
+		{
+			for (std::size_t i = task.begin; i < task.end; ++i)
+			{
+				(*batch.job)(i);
+			}
+		}
+		catch (...)
+		{
+			std::lock_guard lock(batch.errorMutex);
+			if (batch.error == nullptr)
+			{
+				batch.error = std::current_exception();
+			}
+		}
+		// Last touch of the batch, which lives on the stack of the thread waiting for it.
+		batch.remaining.fetch_sub(1, std::memory_order_acq_rel);
+		return true;
+	}
+
+	void JobSystem::WorkerLoop(std::size_t queue)
+	{
+		tlsJobSystem = this;
+		tlsQueue = queue;
+		while (true)
+		{
+			if (TryRunTask(queue))
+			{
+				continue;
+			}
+
+			std::unique_lock lock(_sleepMutex);
+			_wake.wait(lock, [this] { return _stopping || _pending > 0; });
+			if (_stopping && _pending == 0)
+			{
+				return;
+			}
+		}
+	}
+}
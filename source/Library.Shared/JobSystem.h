@@ -0,0 +1,93 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "Vector.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Fixed pool of worker threads running fork/join batches of jobs.
+	/// Every worker owns a queue. It takes its own work from the back and, once that is empty, steals
+	/// from the front of the other queues, so uneven batches even out without a central queue.
+	/// A thread waiting on a batch runs queued jobs itself instead of blocking, which makes it safe
+	/// to call ParallelFor from inside a job.
+	/// </summary>
+	class JobSystem final
+	{
+	public:
+		/// <summary>
+		/// Returns one less than the number of hardware threads, leaving one for the calling thread.
+		/// </summary>
+		static std::size_t DefaultWorkerCount();
+
+		/// <summary>
+		/// Starts given number of worker threads. With zero workers, every batch runs on the caller.
+		/// </summary>
+		explicit JobSystem(std::size_t workerCount = DefaultWorkerCount());
+		JobSystem(const JobSystem&) = delete;
+		JobSystem(JobSystem&&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+		JobSystem& operator=(JobSystem&&) = delete;
+
+		/// <summary>
+		/// Stops and joins the workers. No batch may still be running.
+		/// </summary>
+		~JobSystem();
+
+		/// <summary>
+		/// Returns number of worker threads, not counting callers of ParallelFor.
+		/// </summary>
+		std::size_t WorkerCount() const;
+
+		/// <summary>
+		/// Calls job(i) for every i in [0, count), spread across the workers and the calling thread,
+		/// and returns once every call has finished. Indices are handed out in contiguous chunks.
+		/// If any call throws, the remaining calls still run and the first exception is rethrown.
+		/// </summary>
+		void ParallelFor(std::size_t count, const std::function<void(std::size_t)>& job);
+
+	private:
+		struct Batch final
+		{
+			const std::function<void(std::size_t)>* job;
+			std::atomic<std::size_t> remaining;
+			std::mutex errorMutex;
+			std::exception_ptr error;
+		};
+
+		struct Task final
+		{
+			Batch* batch;
+			std::size_t begin;
+			std::size_t end;
+		};
+
+		struct Queue final
+		{
+			std::mutex mutex;
+			std::deque<Task> tasks;
+		};
+
+		std::size_t CurrentQueue() const;
+		bool TryRunTask(std::size_t queue);
+		void WorkerLoop(std::size_t queue);
+
+		/// <summary>
+		/// Queue 0 is shared by threads outside the pool, queue i + 1 belongs to worker i.
+		/// </summary>
+		std::unique_ptr<Queue[]> _queues;
+		std::size_t _queueCount;
+		Vector<std::thread> _workers;
+		std::atomic<std::size_t> _pending{ 0 };
+		std::mutex _sleepMutex;
+		std::condition_variable _wake;
+		bool _stopping{ false };
+	};
+}
@@ -55,7 +55,8 @@ namespace FieaGameEngine
 
 			topFrame._type = contextType;
 			const std::string& contextKey = topFrame._key;
-			Datum& contextDatum = topFrame._currentScope.Append(contextKey);
+			NameId contextName(contextKey);
+			Datum& contextDatum = topFrame._currentScope.Append(contextName);
 			contextDatum.SetType(contextType);
 
 			if (topFrame._needType)
@@ -64,7 +65,7 @@ namespace FieaGameEngine
 				if (topFrame._className.empty() == false)
 				{
 					auto nestedScope = Factory<Scope>::Create(topFrame._className);
-					topFrame._currentScope.Adopt(*nestedScope, contextKey);
+					topFrame._currentScope.Adopt(*nestedScope, contextName);
 					
 					StackFrame newStack{ key, value, Datum::DatumType::Unknown, std::string(), *nestedScope, false };
 					_contextStack.Push(newStack);
@@ -90,7 +91,8 @@ namespace FieaGameEngine
 
 			Datum::DatumType contextType = topFrame._type;
 			const std::string& contextKey = topFrame._key;
-			Datum& contextDatum = topFrame._currentScope.Append(contextKey);
+			NameId contextName(contextKey);
+			Datum& contextDatum = topFrame._currentScope.Append(contextName);
 
 			if (contextType == Datum::DatumType::Unknown)
 			{
@@ -107,7 +109,7 @@ namespace FieaGameEngine
 						Scope* nestedScope = rtti->As<Scope>();
 						assert(nestedScope != nullptr);
 
-						topFrame._currentScope.Adopt(*nestedScope, contextKey);
+						topFrame._currentScope.Adopt(*nestedScope, contextName);
 
 						StackFrame newStack{ key, value, Datum::DatumType::Unknown, std::string(), *nestedScope, false };
 						_contextStack.Push(newStack);						
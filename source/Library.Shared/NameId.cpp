@@ -0,0 +1,112 @@
+#include "pch.h"
+#include "NameId.h"
+#include "FlatHashmap.h"
+#include <shared_mutex>
+#include <mutex>
+#if defined(_MSC_VER)
+#include <crtdbg.h>
+#endif
+
+namespace FieaGameEngine
+{
+	namespace
+	{
+		/// <summary>
+		/// Interned strings. FlatHashmap keeps entry addresses stable, so NameIds point straight at them.
+		/// Lookups take a shared lock, so threads resolving existing names do not serialize.
+		/// </summary>
+		struct NameTable final
+		{
+			FlatHashmap<std::string, std::size_t> names{ 256 };
+			std::shared_mutex mutex;
+		};
+
+		NameTable& Table()
+		{
+			static NameTable table;
+			return table;
+		}
+
+		/// <summary>
+		/// Interned names live until exit by design. In debug builds their allocations are kept out of
+		/// CRT leak tracking so memory checkpoints taken around code that interns stay balanced.
+		/// </summary>
+		struct IgnoreLeakTracking final
+		{
+#if defined(_DEBUG) && defined(_MSC_VER)
+			IgnoreLeakTracking() :
+				flags(_CrtSetDbgFlag(_CRTDBG_REPORT_FLAG))
+			{
+				_CrtSetDbgFlag(flags & ~_CRTDBG_ALLOC_MEM_DF);
+			}
+
+			~IgnoreLeakTracking()
+			{
+				_CrtSetDbgFlag(flags);
+			}
+
+			int flags;
+#endif
+		};
+	}
+
+	NameId::NameId(const std::string& name)
+	{
+		if (name.empty())
+		{
+			return;
+		}
+
+		NameTable& table = Table();
+		{
+			std::shared_lock lock(table.mutex);
+			const auto& names = table.names;
+			auto it = names.Find(name);
+			if (it != names.cend())
+			{
+				_entry = &(*it);
+				return;
+			}
+		}
+
+		std::unique_lock lock(table.mutex);
+		IgnoreLeakTracking ignore;
+		auto result = table.names.Insert(std::make_pair(name, HashFunctor<std::string>{}(name)));
+		_entry = &(*result.first);
+	}
+
+	NameId::NameId(const char* name) :
+		NameId(std::string(name))
+	{
+	}
+
+	NameId::NameId(const entry_type* entry) :
+		_entry(entry)
+	{
+	}
+
+	NameId NameId::Find(const std::string& name)
+	{
+		NameTable& table = Table();
+		std::shared_lock lock(table.mutex);
+		const auto& names = table.names;
+		auto it = names.Find(name);
+		return it != names.cend() ? NameId(&(*it)) : NameId();
+	}
+
+	const std::string& NameId::Name() const
+	{
+		static const std::string empty;
+		return _entry != nullptr ? _entry->first : empty;
+	}
+
+	bool NameId::operator==(const std::string& rhs) const
+	{
+		return Name() == rhs;
+	}
+
+	bool NameId::operator!=(const std::string& rhs) const
+	{
+		return !operator==(rhs);
+	}
+}
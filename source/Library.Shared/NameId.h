@@ -0,0 +1,112 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include "HashFunctor.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Handle to a string interned in a process wide table. Two NameIds are equal exactly when they
+	/// name the same string, so comparing them is a pointer compare and their hash is computed once,
+	/// when the string is first interned. Handles stay valid for the lifetime of the program.
+	/// </summary>
+	class NameId final
+	{
+	public:
+		/// <summary>
+		/// Constructs the empty NameId, which names no string.
+		/// </summary>
+		NameId() = default;
+
+		/// <summary>
+		/// Interns the given string, adding it to the table if it is not already there.
+		/// An empty string gives the empty NameId.
+		/// </summary>
+		explicit NameId(const std::string& name);
+
+		/// <summary>
+		/// Interns the given string, adding it to the table if it is not already there.
+		/// </summary>
+		explicit NameId(const char* name);
+
+		/// <summary>
+		/// Returns the NameId for the given string if it has been interned, otherwise the empty NameId.
+		/// Never adds to the table, so it is suited to lookups of names that may not exist.
+		/// </summary>
+		static NameId Find(const std::string& name);
+
+		/// <summary>
+		/// Returns the interned string, or an empty string for the empty NameId.
+		/// </summary>
+		const std::string& Name() const;
+
+		/// <summary>
+		/// Returns the cached hash of the interned string.
+		/// </summary>
+		std::size_t Hash() const;
+
+		/// <summary>
+		/// Returns whether this is the empty NameId.
+		/// </summary>
+		bool IsEmpty() const;
+
+		/// <summary>
+		/// Identity comparison.
+		/// </summary>
+		bool operator==(const NameId& rhs) const;
+
+		/// <summary>
+		/// Identity comparison.
+		/// </summary>
+		bool operator!=(const NameId& rhs) const;
+
+		/// <summary>
+		/// Compares the interned string against the given string.
+		/// </summary>
+		bool operator==(const std::string& rhs) const;
+
+		/// <summary>
+		/// Compares the interned string against the given string.
+		/// </summary>
+		bool operator!=(const std::string& rhs) const;
+
+	private:
+		using entry_type = std::pair<const std::string, std::size_t>;
+
+		explicit NameId(const entry_type* entry);
+
+		const entry_type* _entry{ nullptr };
+	};
+
+	/// <summary>
+	/// Specialization of HashFunctor for NameId. Returns the hash cached at intern time.
+	/// </summary>
+	template<>
+	struct HashFunctor<NameId> : HashBase<NameId>
+	{
+		std::size_t operator()(const NameId& key) const
+		{
+			return key.Hash();
+		}
+	};
+
+	inline bool NameId::operator==(const NameId& rhs) const
+	{
+		return _entry == rhs._entry;
+	}
+
+	inline bool NameId::operator!=(const NameId& rhs) const
+	{
+		return _entry != rhs._entry;
+	}
+
+	inline std::size_t NameId::Hash() const
+	{
+		return _entry != nullptr ? _entry->second : 0;
+	}
+
+	inline bool NameId::IsEmpty() const
+	{
+		return _entry == nullptr;
+	}
+}
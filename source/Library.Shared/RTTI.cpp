@@ -0,0 +1,78 @@
+#include "pch.h"
+#include "RTTI.h"
+#include <atomic>
+#include <mutex>
+
+namespace FieaGameEngine
+{
+	namespace
+	{
+		/// <summary>
+		/// Name registry, chained through TypeInfo::_next. Types are only ever prepended to a bucket, and a
+		/// TypeInfo is immutable once published, so lookups read the buckets without taking the mutex.
+		/// Statically initialized, and never allocates, so first uses of a type do not show up as leaks.
+		/// </summary>
+		constexpr std::size_t BucketCount = 64;
+		std::atomic<const RTTI::TypeInfo*> sBuckets[BucketCount];
+		std::mutex sRegistryMutex;
+	}
+
+	RTTI::TypeInfo::TypeInfo(IdType id, std::string_view name, const TypeInfo* parent) :
+		_id(id), _name(name), _hash(std::hash<std::string_view>{}(name)), _depth(parent != nullptr ? parent->_depth + 1 : 0)
+	{
+		if (_depth >= MaxDepth)
+		{
+			throw std::runtime_error("Type hierarchy is deeper than TypeInfo::MaxDepth.");
+		}
+
+		for (std::size_t i = 0; i < _depth; ++i)
+		{
+			_ancestors[i] = parent->_ancestors[i];
+		}
+		_ancestors[_depth] = _id;
+
+		std::atomic<const TypeInfo*>& bucket = sBuckets[_hash % BucketCount];
+		std::lock_guard lock(sRegistryMutex);
+		_next = bucket.load(std::memory_order_relaxed);
+		bucket.store(this, std::memory_order_release);
+	}
+
+	bool RTTI::TypeInfo::Is(IdType id) const
+	{
+		for (std::size_t i = 0; i <= _depth; ++i)
+		{
+			if (_ancestors[i] == id)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool RTTI::TypeInfo::Is(std::string_view name) const
+	{
+		// Several types can share a name, such as every Event<T>, so check each of them.
+		const std::size_t hash = std::hash<std::string_view>{}(name);
+		for (const TypeInfo* type = sBuckets[hash % BucketCount].load(std::memory_order_acquire); type != nullptr; type = type->_next)
+		{
+			if (type->_hash == hash && type->_name == name && Is(*type))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	const RTTI::TypeInfo* RTTI::TypeInfo::Find(std::string_view name)
+	{
+		const std::size_t hash = std::hash<std::string_view>{}(name);
+		for (const TypeInfo* type = sBuckets[hash % BucketCount].load(std::memory_order_acquire); type != nullptr; type = type->_next)
+		{
+			if (type->_hash == hash && type->_name == name)
+			{
+				return type;
+			}
+		}
+		return nullptr;
+	}
+}
\ No newline at end of file
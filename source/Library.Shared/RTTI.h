@@ -1,7 +1,9 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <cstddef>
+#include <type_traits>
 
 namespace FieaGameEngine
 {
@@ -11,35 +13,100 @@ namespace FieaGameEngine
 		using IdType = std::size_t;
 		static IdType TypeIdClass() { return 0; }
 
+		/// <summary>
+		/// Registration record of one type: its id, name, and the ids of the type and each of its ancestors,
+		/// indexed by depth below RTTI. Built once per type on first use, so checking whether an instance is
+		/// of a type compares one slot of this table instead of walking the hierarchy.
+		/// </summary>
+		class TypeInfo final
+		{
+		public:
+			static constexpr std::size_t MaxDepth = 16;
+
+			/// <summary>
+			/// Copies the parent's ancestor table, appends id, and adds this type to the name registry.
+			/// Parent is nullptr for a type deriving directly from RTTI.
+			/// </summary>
+			/// <exception cref="std::runtime_error">Thrown if the hierarchy is deeper than MaxDepth.</exception>
+			TypeInfo(IdType id, std::string_view name, const TypeInfo* parent);
+			TypeInfo(const TypeInfo&) = delete;
+			TypeInfo& operator=(const TypeInfo&) = delete;
+			~TypeInfo() = default;
+
+			IdType Id() const { return _id; }
+			std::string_view Name() const { return _name; }
+			std::size_t Depth() const { return _depth; }
+
+			/// <summary>
+			/// Returns whether this type is type or derives from it. Constant time.
+			/// </summary>
+			bool Is(const TypeInfo& type) const
+			{
+				return type._depth <= _depth && _ancestors[type._depth] == type._id;
+			}
+
+			/// <summary>
+			/// Returns whether this type has given id or derives from the type with it.
+			/// Scans the flat ancestor table, as an id alone does not say at which depth to look.
+			/// </summary>
+			bool Is(IdType id) const;
+
+			/// <summary>
+			/// Returns whether this type or one of its ancestors is named name, looked up in the name registry.
+			/// </summary>
+			bool Is(std::string_view name) const;
+
+			/// <summary>
+			/// Returns the most recently registered type with given name, or nullptr if none is registered.
+			/// A type is registered the first time its TypeInfoClass is called.
+			/// </summary>
+			static const TypeInfo* Find(std::string_view name);
+
+		private:
+			IdType _id;
+			std::string_view _name;
+			std::size_t _hash;
+			std::size_t _depth;
+			IdType _ancestors[MaxDepth];
+			const TypeInfo* _next{ nullptr };
+		};
+
 		virtual ~RTTI() = default;
 
 		virtual FieaGameEngine::RTTI::IdType TypeIdInstance() const = 0;
+		virtual const TypeInfo& TypeInfoInstance() const = 0;
+
+		RTTI* QueryInterface(const IdType id)
+		{
+			return (Is(id) ? this : nullptr);
+		}
 
-		virtual RTTI* QueryInterface(const IdType)
+		bool Is(IdType id) const
 		{
-			return nullptr;
+			return TypeInfoInstance().Is(id);
 		}
 
-		virtual bool Is(IdType) const
+		bool Is(const std::string& name) const
 		{
-			return false;
+			return TypeInfoInstance().Is(std::string_view(name));
 		}
 
-		virtual bool Is(const std::string&) const
+		template <typename T>
+		bool Is() const
 		{
-			return false;
+			return TypeInfoInstance().Is(T::TypeInfoClass());
 		}
 
 		template <typename T>
 		const T* As() const
 		{
-			return (Is(T::TypeIdClass()) ? reinterpret_cast<const T*>(this) : nullptr);
+			return (Is<T>() ? reinterpret_cast<const T*>(this) : nullptr);
 		}
 
 		template <typename T>
 		T* As()
 		{
-			return (Is(T::TypeIdClass()) ? reinterpret_cast<T*>(const_cast<RTTI*>(this)) : nullptr);
+			return (Is<T>() ? reinterpret_cast<T*>(const_cast<RTTI*>(this)) : nullptr);
 		}
 
 		virtual std::string ToString() const
@@ -51,25 +118,37 @@ namespace FieaGameEngine
 		{
 			return this == rhs;
 		}
+
+	protected:
+		/// <summary>
+		/// TypeInfo of given parent type, or nullptr if it is RTTI itself.
+		/// </summary>
+		template <typename TParent>
+		static const TypeInfo* ParentTypeInfo()
+		{
+			if constexpr (std::is_same_v<TParent, RTTI>)
+			{
+				return nullptr;
+			}
+			else
+			{
+				return &TParent::TypeInfoClass();
+			}
+		}
 	};
 
 #define RTTI_DECLARATIONS(Type, ParentType)																						\
 		public:																													\
+			using Base = ParentType;																							\
 			static std::string TypeName() { return std::string(#Type); }														\
 			static FieaGameEngine::RTTI::IdType TypeIdClass() { return sRunTimeTypeId; }																\
-			FieaGameEngine::RTTI::IdType TypeIdInstance() const override { return TypeIdClass(); }											\
-			FieaGameEngine::RTTI* QueryInterface(const RTTI::IdType id) override												\
-            {																													\
-				return (id == sRunTimeTypeId ? reinterpret_cast<FieaGameEngine::RTTI*>(this) : ParentType::QueryInterface(id)); \
-            }																													\
-			bool Is(FieaGameEngine::RTTI::IdType id) const override																			\
+			static const FieaGameEngine::RTTI::TypeInfo& TypeInfoClass()														\
 			{																													\
-				return (id == sRunTimeTypeId ? true : ParentType::Is(id));														\
-			}																													\
-			bool Is(const std::string& name) const override																\
-			{																													\
-				return (name == TypeName() ? true : ParentType::Is(name));														\
+				static const FieaGameEngine::RTTI::TypeInfo typeInfo(reinterpret_cast<FieaGameEngine::RTTI::IdType>(&sRunTimeTypeId), #Type, FieaGameEngine::RTTI::ParentTypeInfo<ParentType>()); \
+				return typeInfo;																								\
 			}																													\
+			FieaGameEngine::RTTI::IdType TypeIdInstance() const override { return TypeIdClass(); }											\
+			const FieaGameEngine::RTTI::TypeInfo& TypeInfoInstance() const override { return TypeInfoClass(); }				\
 			private:																											\
 				static const FieaGameEngine::RTTI::IdType sRunTimeTypeId;
 
@@ -3,6 +3,9 @@
 #include <cstddef>
 #include <stdexcept>
 #include <functional>
+#include <memory>
+#include <cstdlib>
+#include <algorithm>
 
 namespace FieaGameEngine
 {
@@ -29,6 +32,74 @@ namespace FieaGameEngine
 	public:
 		using value_type = T;
 
+		/// <summary>
+		/// Free list of node sized blocks carved out of slabs that double in size as the pool grows.
+		/// Lists constructed with a pool take their nodes from it and give them back on removal, so
+		/// insert/remove churn does not touch the global heap. Slabs are only released when the pool
+		/// is destroyed. Not synchronized, so lists sharing a pool must be used from one thread at a time.
+		/// </summary>
+		class NodePool final
+		{
+			friend class SList;
+
+		public:
+			/// <summary>
+			/// Constructs an empty pool. No memory is allocated until the first node is needed.
+			/// </summary>
+			/// <param name="firstSlabCapacity">Number of nodes in the first slab.</param>
+			explicit NodePool(std::size_t firstSlabCapacity = 16);
+
+			NodePool(const NodePool&) = delete;
+			NodePool(NodePool&&) = delete;
+			NodePool& operator=(const NodePool&) = delete;
+			NodePool& operator=(NodePool&&) = delete;
+
+			/// <summary>
+			/// Releases all slabs. Every node taken from the pool must have been returned.
+			/// </summary>
+			~NodePool();
+
+			/// <summary>
+			/// Number of nodes carved from slabs so far, in use or not.
+			/// </summary>
+			std::size_t Capacity() const;
+
+			/// <summary>
+			/// Number of nodes ready to be handed out without allocating.
+			/// </summary>
+			std::size_t Available() const;
+
+			/// <summary>
+			/// Grows the pool so at least the given number of nodes can be handed out without allocating.
+			/// </summary>
+			void Reserve(std::size_t count);
+
+		private:
+			union Block
+			{
+				Block* next;
+				alignas(Node) unsigned char storage[sizeof(Node)];
+			};
+
+			struct Slab final
+			{
+				Slab* next;
+			};
+
+			Node* Acquire();
+			void Release(Node* node);
+			void AddSlab(std::size_t capacity);
+
+			inline static const std::size_t MaximumSlabCapacity = 1024;
+			inline static const std::size_t SlabHeaderSize = (sizeof(Slab) + alignof(Block) - 1) / alignof(Block) * alignof(Block);
+
+			Slab* _slabs{ nullptr };
+			Block* _free{ nullptr };
+			std::size_t _nextSlabCapacity;
+			std::size_t _capacity{ 0 };
+			std::size_t _available{ 0 };
+		};
+
 		/// <summary>
 		/// Used to traverse and mutate items in a non const SList.
 		/// </summary>
@@ -184,7 +255,13 @@ namespace FieaGameEngine
 		SList();
 
 		/// <summary>
-		/// Instantiate SList from existing SList instance.
+		/// Instantiate SList that allocates its nodes from the given pool. A null pool means the global heap.
+		/// </summary>
+		/// <param name="pool">Pool shared with any other list that may exchange nodes with this one.</param>
+		explicit SList(std::shared_ptr<NodePool> pool);
+
+		/// <summary>
+		/// Instantiate SList from existing SList instance. The copy shares the source's node pool.
 		/// </summary>
 		/// <typeparam name="other">The source instance.</typeparam>
 		SList(const SList& other);
@@ -196,10 +273,10 @@ namespace FieaGameEngine
 		SList(const std::initializer_list<T> list);
 
 		/// <summary>
-		/// Move constructor. Shallow copy memory of given into this instance.
+		/// Move constructor. Takes the nodes and pool of given, leaving it empty.
 		/// </summary>
 		/// <param name="other">Given R value SList.</param>
-		SList(SList&& other) noexcept = default;
+		SList(SList&& other) noexcept;
 
 		/// <summary>
 		/// Delete data in list and destruct SList.
@@ -221,11 +298,11 @@ namespace FieaGameEngine
 		SList& operator=(const std::initializer_list<T> list);
 
 		/// <summary>
-		/// Move Assignment Operator. Shallow copies rhs to lhs.
+		/// Move Assignment Operator. Clears lhs, then takes the nodes and pool of rhs, leaving it empty.
 		/// </summary>
 		/// <param name="other">R value SList.</param>
 		/// <returns>L value SList reference.</returns>
-		SList& operator=(SList&& other) noexcept = default;
+		SList& operator=(SList&& other) noexcept;
 
 		/// <summary>
 		/// Returns an ConstIterator pointing to the start of the SList.
@@ -349,6 +426,14 @@ namespace FieaGameEngine
 		/// </summary>
 		void PopBack();
 
+		/// <summary>
+		/// Unlinks the front node of this list and links it onto the back of the given list.
+		/// No allocation occurs, so references to the moved data remain valid. Both lists must share
+		/// a node pool, otherwise throws.
+		/// </summary>
+		/// <param name="destination">List that receives the node.</param>
+		void TransferFront(SList& destination);
+
 		/// <summary>
 		/// Returns boolean whether list is empty or not.
 		/// </summary>
@@ -366,10 +451,20 @@ namespace FieaGameEngine
 		/// </summary>
 		void Clear();
 
+		/// <summary>
+		/// Returns the pool this list allocates nodes from, or null if it uses the global heap.
+		/// </summary>
+		const std::shared_ptr<NodePool>& Pool() const;
+
 	private:
+		Node* CreateNode(const T& data, Node* next = nullptr);
+		void DestroyNode(Node* node);
+		void RemoveByShifting(Node* node);
+
 		size_t size{ 0 };
 		Node* front{ nullptr };
 		Node* back{ nullptr };
+		std::shared_ptr<NodePool> pool{ };
 	};
 }
 
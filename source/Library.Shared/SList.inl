@@ -15,6 +15,91 @@ namespace FieaGameEngine
 		other.next = nullptr;
 	}
 
+	template<typename T>
+	SList<T>::NodePool::NodePool(std::size_t firstSlabCapacity) :
+		_nextSlabCapacity(std::max(firstSlabCapacity, std::size_t(1)))
+	{
+	}
+
+	template<typename T>
+	SList<T>::NodePool::~NodePool()
+	{
+		assert(_available == _capacity);
+		while (_slabs != nullptr)
+		{
+			Slab* next = _slabs->next;
+			std::free(_slabs);
+			_slabs = next;
+		}
+	}
+
+	template<typename T>
+	inline std::size_t SList<T>::NodePool::Capacity() const
+	{
+		return _capacity;
+	}
+
+	template<typename T>
+	inline std::size_t SList<T>::NodePool::Available() const
+	{
+		return _available;
+	}
+
+	template<typename T>
+	void SList<T>::NodePool::Reserve(std::size_t count)
+	{
+		if (count > _available)
+		{
+			AddSlab(std::max(count - _available, _nextSlabCapacity));
+		}
+	}
+
+	template<typename T>
+	inline typename SList<T>::Node* SList<T>::NodePool::Acquire()
+	{
+		if (_free == nullptr)
+		{
+			AddSlab(_nextSlabCapacity);
+		}
+		Block* block = _free;
+		_free = block->next;
+		--_available;
+		return reinterpret_cast<Node*>(block->storage);
+	}
+
+	template<typename T>
+	inline void SList<T>::NodePool::Release(Node* node)
+	{
+		Block* block = reinterpret_cast<Block*>(node);
+		block->next = _free;
+		_free = block;
+		++_available;
+	}
+
+	template<typename T>
+	void SList<T>::NodePool::AddSlab(std::size_t capacity)
+	{
+		static_assert(alignof(Block) <= alignof(std::max_align_t), "Node alignment exceeds what the heap guarantees.");
+
+		Slab* slab = static_cast<Slab*>(std::malloc(SlabHeaderSize + sizeof(Block) * capacity));
+		if (slab == nullptr)
+		{
+			throw std::bad_alloc();
+		}
+		slab->next = _slabs;
+		_slabs = slab;
+
+		Block* blocks = reinterpret_cast<Block*>(reinterpret_cast<unsigned char*>(slab) + SlabHeaderSize);
+		for (std::size_t i = capacity; i > 0; --i)
+		{
+			blocks[i - 1].next = _free;
+			_free = &blocks[i - 1];
+		}
+		_capacity += capacity;
+		_available += capacity;
+		_nextSlabCapacity = std::min(std::max(capacity, _nextSlabCapacity) * 2, MaximumSlabCapacity);
+	}
+
 	template<typename T>
 	SList<T>::Iterator::Iterator(const SList& owner, Node* node) :
 		owner(&owner), node(node)
@@ -193,7 +278,7 @@ namespace FieaGameEngine
 		else
 		{
 			Node* temp = it.node->next;
-			it.node->next = new Node(data, temp);
+			it.node->next = CreateNode(data, temp);
 			size++;
 			return Iterator(*this, it.node->next);
 		}
@@ -237,19 +322,13 @@ namespace FieaGameEngine
 	{
 		if (size > 0 && it != end())
 		{
-			EqualityFunctor equalityFunc;
-
-			if (equalityFunc(Back(), it.node->data))
+			if (it.node == back)
 			{
 				PopBack();
 			}
 			else
 			{
-				Node* nextNode = it.node->next;
-				it.node->~Node();
-				new (it.node) Node(std::move(*nextNode));
-				delete nextNode;
-				--size;
+				RemoveByShifting(it.node);
 			}
 			return true;
 		}
@@ -268,17 +347,13 @@ namespace FieaGameEngine
 			{
 				if (equalityFunc(it.node->data, data))
 				{
-					if (equalityFunc(Back(), data))
+					if (it.node == back)
 					{
 						PopBack();
 					}
 					else
 					{
-						Node* nextNode = it.node->next;
-						it.node->~Node();
-						new (it.node) Node(std::move(*nextNode));
-						delete nextNode;
-						--size;
+						RemoveByShifting(it.node);
 					}
 					return true;
 				}				
@@ -287,13 +362,68 @@ namespace FieaGameEngine
 		return false;
 	}
 
+	template<typename T>
+	void SList<T>::RemoveByShifting(Node* node)
+	{
+		Node* nextNode = node->next;
+		if (nextNode == back)
+		{
+			back = node;
+		}
+		node->~Node();
+		new (node) Node(std::move(*nextNode));
+		DestroyNode(nextNode);
+		--size;
+	}
+
+	template<typename T>
+	typename SList<T>::Node* SList<T>::CreateNode(const T& data, Node* next)
+	{
+		if (pool == nullptr)
+		{
+			return new Node(data, next);
+		}
+
+		Node* node = pool->Acquire();
+		try
+		{
+			return new (node) Node(data, next);
+		}
+		catch (...)
+		{
+			pool->Release(node);
+			throw;
+		}
+	}
+
+	template<typename T>
+	void SList<T>::DestroyNode(Node* node)
+	{
+		if (pool == nullptr)
+		{
+			delete node;
+		}
+		else
+		{
+			node->~Node();
+			pool->Release(node);
+		}
+	}
+
 	template<typename T>
 	SList<T>::SList()
 	{
 	}
 
 	template<typename T>
-	SList<T>::SList(const SList& other)
+	SList<T>::SList(std::shared_ptr<NodePool> pool) :
+		pool(std::move(pool))
+	{
+	}
+
+	template<typename T>
+	SList<T>::SList(const SList& other) :
+		pool(other.pool)
 	{
 		Node* otherPtr = other.front;
 		while (otherPtr != nullptr)
@@ -312,6 +442,14 @@ namespace FieaGameEngine
 		}
 	}
 
+	template<typename T>
+	SList<T>::SList(SList&& other) noexcept :
+		size(other.size), front(other.front), back(other.back), pool(std::move(other.pool))
+	{
+		other.size = 0;
+		other.front = other.back = nullptr;
+	}
+
 	template<typename T>
 	SList<T>::~SList()
 	{
@@ -335,6 +473,23 @@ namespace FieaGameEngine
 		return *this;
 	}
 
+	template<typename T>
+	SList<T>& SList<T>::operator=(SList&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Clear();
+			size = other.size;
+			front = other.front;
+			back = other.back;
+			pool = std::move(other.pool);
+
+			other.size = 0;
+			other.front = other.back = nullptr;
+		}
+		return *this;
+	}
+
 	template<typename T>
 	SList<T>& SList<T>::operator=(const std::initializer_list<T> list)
 	{
@@ -389,7 +544,7 @@ namespace FieaGameEngine
 	template<typename T>
 	typename SList<T>::Iterator SList<T>::PushFront(const T& entry)
 	{
-		front = new Node(entry, front);
+		front = CreateNode(entry, front);
 		if (size == 0)
 		{
 			back = front;
@@ -413,7 +568,7 @@ namespace FieaGameEngine
 		{
 			Node* temp = front;
 			front = front->next;
-			delete temp;
+			DestroyNode(temp);
 			--size;
 		}
 	}
@@ -421,7 +576,7 @@ namespace FieaGameEngine
 	template<typename T>
 	typename SList<T>::Iterator SList<T>::PushBack(const T& entry)
 	{
-		Node* node = new Node(entry);
+		Node* node = CreateNode(entry);
 		if (size == 0)
 		{
 			front = node;
@@ -456,11 +611,45 @@ namespace FieaGameEngine
 			Node* temp = back;
 			back = currentNode;
 			back->next = nullptr;
-			delete temp;
+			DestroyNode(temp);
 			--size;
 		}
 	}
 
+	template<typename T>
+	void SList<T>::TransferFront(SList& destination)
+	{
+		if (front == nullptr)
+		{
+			throw std::runtime_error("Cannot transfer front of empty list.");
+		}
+
+		if (pool != destination.pool)
+		{
+			throw std::runtime_error("Cannot transfer between lists with different node pools.");
+		}
+
+		Node* node = front;
+		front = front->next;
+		if (front == nullptr)
+		{
+			back = nullptr;
+		}
+		--size;
+
+		node->next = nullptr;
+		if (destination.size == 0)
+		{
+			destination.front = node;
+		}
+		else
+		{
+			destination.back->next = node;
+		}
+		destination.back = node;
+		++destination.size;
+	}
+
 	template<typename T>
 	inline bool SList<T>::IsEmpty() const
 	{
@@ -480,10 +669,16 @@ namespace FieaGameEngine
 		while (currentNode != nullptr)
 		{
 			Node* nextNode = currentNode->next;
-			delete currentNode;
+			DestroyNode(currentNode);
 			currentNode = nextNode;
 		}
 		front = back = nullptr;
 		size = 0;
 	}
+
+	template<typename T>
+	inline const std::shared_ptr<typename SList<T>::NodePool>& SList<T>::Pool() const
+	{
+		return pool;
+	}
 }
\ No newline at end of file
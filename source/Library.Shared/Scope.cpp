@@ -1,21 +1,80 @@
 #include "pch.h"
 #include "Scope.h"
+#include <algorithm>
 
 namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(Scope)
 
+	std::atomic<std::size_t> Scope::_hierarchyGeneration{ 0 };
+	std::atomic<std::size_t> Scope::_structureGeneration{ 0 };
+
+	/// <summary>
+	/// Every Scope holding a name in an indexed hierarchy, with the position of the name in that Scope.
+	/// </summary>
+	struct Scope::NameIndex final
+	{
+		using entry_type = std::pair<Scope*, std::size_t>;
+
+		void Add(NameId name, Scope& scope, std::size_t index)
+		{
+			Entries[name].PushBack(std::make_pair(&scope, index));
+		}
+
+		void Remove(NameId name, const Scope& scope)
+		{
+			Vector<entry_type>& scopes = Entries.At(name);
+			for (std::size_t i = 0; i < scopes.Size(); ++i)
+			{
+				if (scopes[i].first == &scope)
+				{
+					scopes[i] = scopes.Back();
+					scopes.PopBack();
+					return;
+				}
+			}
+			assert(false);
+		}
+
+		Hashmap<NameId, Vector<entry_type>> Entries;
+	};
+
+	Scope::Layout::Layout(const Vector<NameId>& names) :
+		_names(names), _indices(std::max(names.Size(), std::size_t(2)))
+	{
+		for (std::size_t i = 0; i < _names.Size(); ++i)
+		{
+			_indices.Insert(std::make_pair(_names[i], i));
+		}
+	}
+
+	std::size_t Scope::Layout::IndexOf(NameId name) const
+	{
+		auto it = _indices.Find(name);
+		return it != _indices.cend() ? (*it).second : _names.Size();
+	}
+
 	Scope::Scope(std::size_t capacity) :
-		_unorderedMap(capacity), _orderedVector(capacity)
+		_unorderedMap(std::in_place, capacity), _orderedVector(capacity)
 	{
 	}
 
-	Scope::Scope(const Scope& other) :
-		_unorderedMap(other._unorderedMap.BucketCount()), _orderedVector(other._orderedVector.Capacity())
+	Scope::Scope(const Layout& layout)
 	{
-		for (auto it : other._orderedVector)
+		UseLayout(&layout);
+	}
+
+	Scope::Scope(const Scope& other)
+	{
+		if (other._unorderedMap.has_value())
+		{
+			_unorderedMap.emplace(other._unorderedMap->BucketCount());
+		}
+		UseLayout(other._layout);
+		_orderedVector.Reserve(other._orderedVector.Capacity());
+		for (const Member& member : other._orderedVector)
 		{
-			Datum& currentDatum = (*it).second;
+			Datum& currentDatum = *member._datum;
 			Datum newDatum;
 			if (currentDatum.Type() == Datum::DatumType::Table)
 			{
@@ -31,32 +90,36 @@ namespace FieaGameEngine
 			{
 				newDatum = currentDatum;
 			}
-			std::pair entry = std::make_pair((*it).first, newDatum);
-			std::pair result = _unorderedMap.Insert(entry);
-			_orderedVector.PushBack(&(*result.first));
+			Datum& slot = Append(member._name);
+			slot = std::move(newDatum);
+			ClaimChildren(slot);
 		}
+		// A copy starts out attached to nothing, so spawning from a prototype leaves every hierarchy as it was.
 	}
 
 	Scope::Scope(Scope&& other) noexcept :
+		_layout(other._layout), _layoutSlots(other._layoutSlots),
 		_unorderedMap(std::move(other._unorderedMap)), _orderedVector(std::move(other._orderedVector))
 	{
-		for (auto it : _orderedVector)
+		other._layout = nullptr;
+		other._layoutSlots = nullptr;
+		bool tookChildren = false;
+		for (const Member& member : _orderedVector)
 		{
-			Datum& currentDatum = (*it).second;
-			if (currentDatum.Type() == Datum::DatumType::Table)
-			{
-				for (std::size_t i = 0; i < currentDatum.Size(); ++i)
-				{
-					currentDatum.GetTable(i)._parent = this;
-				}
-			}
+			tookChildren |= member._datum->Type() == Datum::DatumType::Table && member._datum->Size() > 0;
+			ClaimChildren(*member._datum);
 		}
+		TakeNameIndexFrom(other);
 		if (other._parent != nullptr)
 		{
 			other._parent->Orphan(other);
 			other._parent = nullptr;
 		}
 		other.Clear();
+		if (tookChildren)
+		{
+			HierarchyChanged();
+		}
 	}
 
 	Scope& Scope::operator=(const Scope& other)
@@ -64,11 +127,21 @@ namespace FieaGameEngine
 		if (&other != this && !other.IsAncestorOf(*this) && !other.IsDescendantOf(*this))
 		{
 			Clear();
-			_unorderedMap = Hashmap<std::string, Datum>(other._unorderedMap.BucketCount());
-			_orderedVector = Vector<typename Hashmap<std::string, Datum>::pair_type*>(other._orderedVector.Capacity());
-			for (auto it : other._orderedVector)
+			NameIndex* index = _nameIndex;
+			_nameIndex = nullptr;
+			if (other._unorderedMap.has_value())
 			{
-				Datum& currentDatum = (*it).second;
+				_unorderedMap.emplace(other._unorderedMap->BucketCount());
+			}
+			else
+			{
+				_unorderedMap.reset();
+			}
+			UseLayout(other._layout);
+			_orderedVector.Reserve(other._orderedVector.Capacity());
+			for (const Member& member : other._orderedVector)
+			{
+				Datum& currentDatum = *member._datum;
 				Datum newDatum;
 				if (currentDatum.Type() == Datum::DatumType::Table)
 				{
@@ -84,10 +157,15 @@ namespace FieaGameEngine
 				{
 					newDatum = currentDatum;
 				}
-				std::pair entry = std::make_pair((*it).first, newDatum);
-				std::pair result = _unorderedMap.Insert(entry);
-				_orderedVector.PushBack(&(*result.first));
+				Datum& slot = Append(member._name);
+				slot = std::move(newDatum);
+				ClaimChildren(slot);
 			}
+			if (index != nullptr)
+			{
+				IndexSubtree(index);
+			}
+			HierarchyChanged();
 		}		
 		return *this;
 	}
@@ -100,14 +178,25 @@ namespace FieaGameEngine
 			_parent = nullptr;
 		}
 		Clear();
+		DisableNameIndex();
 		_unorderedMap = std::move(other._unorderedMap);
 		_orderedVector = std::move(other._orderedVector);
+		_layout = other._layout;
+		_layoutSlots = other._layoutSlots;
+		other._layout = nullptr;
+		other._layoutSlots = nullptr;
+		for (const Member& member : _orderedVector)
+		{
+			ClaimChildren(*member._datum);
+		}
+		TakeNameIndexFrom(other);
 		if (other._parent != nullptr)
 		{
 			other._parent->Orphan(other);
 			other._parent = nullptr;
 		}
 		other.Clear();
+		HierarchyChanged();
 		return *this;
 	}
 
@@ -119,6 +208,7 @@ namespace FieaGameEngine
 			_parent = nullptr;
 		}
 		Clear();
+		delete _nameIndex;
 	}
 
 	bool Scope::operator==(const Scope& rhs) const
@@ -130,15 +220,15 @@ namespace FieaGameEngine
 			{
 				for (std::size_t i = 0; i < _orderedVector.Size(); ++i)
 				{
-					auto& lhsPair = *_orderedVector[i];
-					auto& rhsPair = *rhs._orderedVector[i];
+					const Member& lhsMember = _orderedVector[i];
+					const Member& rhsMember = rhs._orderedVector[i];
 
-					if (lhsPair.first == "this"s)
+					if (lhsMember._name == "this"s)
 					{
 						continue;
 					}
 
-					if (lhsPair != rhsPair)
+					if (lhsMember._name != rhsMember._name || *lhsMember._datum != *rhsMember._datum)
 					{
 						areSame = false;
 						break;
@@ -191,11 +281,51 @@ namespace FieaGameEngine
 		return new Scope(*this);
 	}
 
+	void Scope::Reserve(std::size_t capacity)
+	{
+		const std::size_t layoutSize = _layout != nullptr ? _layout->_names.Size() : 0;
+		if (capacity > layoutSize)
+		{
+			if (!_unorderedMap.has_value())
+			{
+				_unorderedMap.emplace(DefaultCapacity);
+			}
+			_unorderedMap->Reserve(capacity - layoutSize);
+		}
+		_orderedVector.Reserve(capacity);
+	}
+
 	Datum* Scope::Find(const std::string& name)
 	{
-		if (_unorderedMap.ContainsKey(name))
+		NameId id = NameId::Find(name);
+		return id.IsEmpty() ? nullptr : Find(id);
+	}
+
+	const Datum* Scope::Find(const std::string& name) const
+	{
+		NameId id = NameId::Find(name);
+		return id.IsEmpty() ? nullptr : Find(id);
+	}
+
+	Datum* Scope::Find(NameId name)
+	{
+		if (_layout != nullptr)
 		{
-			return &(_unorderedMap.At(name));
+			const std::size_t index = _layout->IndexOf(name);
+			if (index < _layout->_names.Size())
+			{
+				return &_layoutSlots[index];
+			}
+		}
+		if (!_unorderedMap.has_value())
+		{
+			return nullptr;
+		}
+
+		auto it = _unorderedMap->Find(name);
+		if (it != _unorderedMap->end())
+		{
+			return &(*it).second._datum;
 		}
 		else
 		{
@@ -203,11 +333,25 @@ namespace FieaGameEngine
 		}
 	}
 
-	const Datum* Scope::Find(const std::string& name) const
+	const Datum* Scope::Find(NameId name) const
 	{
-		if (_unorderedMap.ContainsKey(name))
+		if (_layout != nullptr)
+		{
+			const std::size_t index = _layout->IndexOf(name);
+			if (index < _layout->_names.Size())
+			{
+				return &_layoutSlots[index];
+			}
+		}
+		if (!_unorderedMap.has_value())
+		{
+			return nullptr;
+		}
+
+		auto it = _unorderedMap->Find(name);
+		if (it != _unorderedMap->cend())
 		{
-			return &(_unorderedMap.At(name));
+			return &(*it).second._datum;
 		}
 		else
 		{
@@ -217,90 +361,118 @@ namespace FieaGameEngine
 
 	Datum* Scope::Search(const std::string& name)
 	{
-		if (_unorderedMap.ContainsKey(name))
+		NameId id = NameId::Find(name);
+		return id.IsEmpty() ? nullptr : Search(id);
+	}
+
+	const Datum* Scope::Search(const std::string& name) const
+	{
+		NameId id = NameId::Find(name);
+		return id.IsEmpty() ? nullptr : Search(id);
+	}
+
+	Datum* Scope::Search(const std::string& name, Scope*& foundScope)
+	{
+		NameId id = NameId::Find(name);
+		return id.IsEmpty() ? nullptr : Search(id, foundScope);
+	}
+
+	const Datum* Scope::Search(const std::string& name, const Scope*& foundScope) const
+	{
+		NameId id = NameId::Find(name);
+		return id.IsEmpty() ? nullptr : Search(id, foundScope);
+	}
+
+	Datum* Scope::Search(NameId name)
+	{
+		Datum* datum = Find(name);
+		if (datum == nullptr && _parent != nullptr)
 		{
-			return &(_unorderedMap.At(name));
+			return _parent->Search(name);
 		}
-		else
+		return datum;
+	}
+
+	const Datum* Scope::Search(NameId name) const
+	{
+		const Datum* datum = Find(name);
+		if (datum == nullptr && _parent != nullptr)
 		{
-			if (_parent != nullptr)
-			{
-				return _parent->Search(name);
-			}
-			else
-			{
-				return nullptr;
-			}
+			return _parent->Search(name);
 		}
+		return datum;
 	}
 
-	const Datum* Scope::Search(const std::string& name) const
+	Datum* Scope::Search(NameId name, Scope*& foundScope)
 	{
-		if (_unorderedMap.ContainsKey(name))
+		Datum* datum = Find(name);
+		if (datum != nullptr)
 		{
-			return &(_unorderedMap.At(name));
+			foundScope = this;
+			return datum;
+		}
+		else if (_parent != nullptr)
+		{
+			return _parent->Search(name, foundScope);
 		}
 		else
 		{
-			if (_parent != nullptr)
-			{
-				return _parent->Search(name);
-			}
-			else
-			{
-				return nullptr;
-			}
+			return nullptr;
 		}
 	}
 
-	Datum* Scope::Search(const std::string& name, Scope*& foundScope)
+	const Datum* Scope::Search(NameId name, const Scope*& foundScope) const
 	{
-		if (_unorderedMap.ContainsKey(name))
+		const Datum* datum = Find(name);
+		if (datum != nullptr)
 		{
 			foundScope = this;
-			return &(_unorderedMap.At(name));
+			return datum;
+		}
+		else if (_parent != nullptr)
+		{
+			return _parent->Search(name, foundScope);
 		}
 		else
 		{
-			if (_parent != nullptr)
-			{
-				return _parent->Search(name, foundScope);
-			}
-			else
-			{
-				return nullptr;
-			}
+			return nullptr;
 		}
 	}
 
-	const Datum* Scope::Search(const std::string& name, const Scope*& foundScope) const
+	std::pair<Scope*, std::size_t> Scope::DownSearch(const std::string& name)
 	{
-		if (_unorderedMap.ContainsKey(name))
+		NameId id = NameId::Find(name);
+		if (id.IsEmpty())
 		{
-			foundScope = this;
-			return &(_unorderedMap.At(name));
+			return std::make_pair(nullptr, 0);
 		}
-		else
+		return DownSearch(id);
+	}
+
+	std::pair<Scope*, std::size_t> Scope::DownSearch(NameId name)
+	{
+		if (OwnsNameIndex())
 		{
-			if (_parent != nullptr)
+			const auto& entries = _nameIndex->Entries;
+			auto it = entries.Find(name);
+			if (it == entries.cend() || (*it).second.IsEmpty())
 			{
-				return _parent->Search(name, foundScope);
+				return std::make_pair(nullptr, 0);
 			}
-			else
+			if ((*it).second.Size() == 1)
 			{
-				return nullptr;
+				return (*it).second.Front();
 			}
+			// Several Scopes hold the name, fall back to the scan to find the first in search order.
 		}
-	}
 
-	std::pair<Scope*, std::size_t> Scope::DownSearch(const std::string& name)
-	{
-		for (auto pair : _orderedVector)
+		for (std::size_t index = 0; index < _orderedVector.Size(); ++index)
 		{
-			Datum& datum = pair->second;
-			if (pair->first == name)
+			const Member& member = _orderedVector[index];
+			Datum& datum = *member._datum;
+			if (member._name == name)
 			{
-				return std::make_pair(this, _orderedVector.IndexOf(pair));
+				return std::make_pair(this, index);
 			}
 			else if (datum.Type() == Datum::DatumType::Table)
 			{
@@ -351,34 +523,81 @@ namespace FieaGameEngine
 
 	Datum& Scope::Append(const std::string& name, bool& wasInserted)
 	{
-		if (name.empty())
+		return Append(NameId(name), wasInserted);
+	}
+
+	Datum& Scope::Append(NameId name)
+	{
+		bool wasInserted;
+		return Append(name, wasInserted);
+	}
+
+	Datum& Scope::Append(NameId name, bool& wasInserted)
+	{
+		if (name.IsEmpty())
 		{
 			throw std::invalid_argument("Name cannot be empty");
 		}
 
-		std::pair result = _unorderedMap.Insert(std::make_pair(name, Datum()));
+		if (_layout != nullptr)
+		{
+			const std::size_t index = _layout->IndexOf(name);
+			if (index < _layout->_names.Size())
+			{
+				wasInserted = false;
+				return _layoutSlots[index];
+			}
+		}
+		if (!_unorderedMap.has_value())
+		{
+			_unorderedMap.emplace(DefaultCapacity);
+		}
+
+		std::pair result = _unorderedMap->Insert(std::make_pair(name, Slot{ Datum(), _orderedVector.Size() }));
 		auto& position = result.first;
 		wasInserted = result.second;
 		if (wasInserted)
 		{
-			_orderedVector.PushBack(&(*position));
+			_orderedVector.PushBack(Member{ name, &(*position).second._datum });
+			_structureGeneration.fetch_add(1, std::memory_order_relaxed);
+			if (_nameIndex != nullptr)
+			{
+				_nameIndex->Add(name, *this, _orderedVector.Size() - 1);
+			}
 		}
 
-		return (*position).second;
+		return (*position).second._datum;
 	}
 
 	Scope& Scope::AppendScope(const std::string& name)
+	{
+		return AppendScope(NameId(name));
+	}
+
+	Scope& Scope::AppendScope(NameId name)
 	{
 		bool wasInserted;
 		Datum& datum = Append(name, wasInserted);
 
 		Scope* newScope = new Scope();
-		newScope->_parent = this;
+		newScope->_nameIndex = _nameIndex;
 		datum.PushBackTable(*newScope);
-		return datum.GetTable();
+		ClaimChildren(datum, datum.Size() - 1);
+		// A Scope with no parent is still being built, as Attributed::Populate does for prescribed
+		// tables, so no cache can be tracking it. Skipping the bump keeps construction on job threads safe.
+		if (_parent != nullptr)
+		{
+			HierarchyChanged();
+		}
+		return *newScope;
 	}
 
 	void Scope::Adopt(Scope& child, const std::string& name)
+	{
+		Adopt(child, NameId(name));
+	}
+
+	void Scope::Adopt(Scope& child, NameId name)
 	{
 		if (&child == this)
 		{
@@ -405,8 +624,14 @@ namespace FieaGameEngine
 		{
 			child._parent->Orphan(child);
 		}
-		child._parent = this;
+		child.DisableNameIndex();
 		datum.PushBackTable(child);
+		ClaimChildren(datum, datum.Size() - 1);
+		if (_nameIndex != nullptr)
+		{
+			child.IndexSubtree(_nameIndex);
+		}
+		HierarchyChanged();
 	}
 
 	Scope* Scope::GetParent() const
@@ -421,9 +646,20 @@ namespace FieaGameEngine
 
 	const Datum& Scope::operator[](const std::string& name) const
 	{
-		if (_unorderedMap.ContainsKey(name))
+		return operator[](NameId::Find(name));
+	}
+
+	Datum& Scope::operator[](NameId name)
+	{
+		return Append(name);
+	}
+
+	const Datum& Scope::operator[](NameId name) const
+	{
+		const Datum* datum = Find(name);
+		if (datum != nullptr)
 		{
-			return (*_unorderedMap.Find(name)).second;
+			return *datum;
 		}
 		else
 		{
@@ -433,30 +669,42 @@ namespace FieaGameEngine
 
 	Datum& Scope::operator[](std::size_t index)
 	{
-		return (*_orderedVector[index]).second;
+		return *_orderedVector[index]._datum;
 	}
 
 	const Datum& Scope::operator[](std::size_t index) const
 	{
-		return (*_orderedVector[index]).second;
+		return *_orderedVector[index]._datum;
+	}
+
+	gsl::span<const Scope::Member> Scope::Members() const
+	{
+		return gsl::span<const Member>(_orderedVector.IsEmpty() ? nullptr : &_orderedVector.Front(), _orderedVector.Size());
+	}
+
+	NameId Scope::NameAt(std::size_t index) const
+	{
+		if (index >= _orderedVector.Size())
+		{
+			throw std::out_of_range("Invalid member index.");
+		}
+		return _orderedVector[index]._name;
 	}
 
 	std::pair<Datum*, std::size_t> Scope::FindContainedScope(const Scope& scope) const
 	{
 		std::pair<Datum*, std::size_t> result = std::make_pair(nullptr, std::numeric_limits<std::size_t>::max());
-		for (auto it : _orderedVector)
+		for (const Member& member : _orderedVector)
 		{
-			Datum& datum = (*it).second;
+			Datum& datum = *member._datum;
 			if (datum.Type() == Datum::DatumType::Table)
 			{
-				for (std::size_t i = 0; i < datum.Size(); ++i)
+				auto [index, wasFound] = datum.FindTable(const_cast<Scope*>(&scope));
+				if (wasFound)
 				{
-					if (datum.GetTable(i) == scope)
-					{
-						result.first = &datum;
-						result.second = i;
-						break;
-					}
+					result.first = &datum;
+					result.second = index;
+					break;
 				}
 			}
 		}
@@ -465,42 +713,243 @@ namespace FieaGameEngine
 
 	void Scope::Clear()
 	{
-		for (auto it : _orderedVector)
+		if (!_orderedVector.IsEmpty())
 		{
-			Datum& datum = it->second;
-			if (datum.Type() == Datum::DatumType::Table)
+			_structureGeneration.fetch_add(1, std::memory_order_relaxed);
+		}
+		for (const Member& member : _orderedVector)
+		{
+			if (_nameIndex != nullptr)
+			{
+				_nameIndex->Remove(member._name, *this);
+			}
+
+			Datum& datum = *member._datum;
+			if (datum.Type() == Datum::DatumType::Table && datum.Size() > 0)
 			{
 				assert(!datum.IsExternal());
 				for (std::size_t i = 0; i < datum.Size(); ++i)
 				{
-					datum.GetTable(i)._parent = nullptr;
-					delete &datum.GetTable(i);
+					Scope& child = datum.GetTable(i);
+					child.IndexSubtree(nullptr);
+					child._parent = nullptr;
+					child._parentDatum = nullptr;
+					delete &child;
 				}
 				datum.Clear();
+				HierarchyChanged();
 			}
 		}
-		_unorderedMap.Clear();
+		if (_unorderedMap.has_value())
+		{
+			_unorderedMap->Clear();
+		}
 		_orderedVector.Clear();
+		ReleaseLayout();
+	}
+
+	void Scope::UseLayout(const Layout* layout)
+	{
+		assert(_orderedVector.IsEmpty() && _layoutSlots == nullptr);
+		_layout = layout;
+		if (layout != nullptr)
+		{
+			const std::size_t size = layout->_names.Size();
+			void* block = ::operator new(size * (sizeof(Datum) + sizeof(Member)));
+			_layoutSlots = static_cast<Datum*>(block);
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				new (_layoutSlots + i) Datum();
+			}
+
+			MemberAllocator allocator;
+			allocator._reserved = _layoutSlots + size;
+			allocator._reservedBytes = size * sizeof(Member);
+			_orderedVector = member_vector_type(size, allocator);
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				_orderedVector.PushBack(Member{ layout->_names[i], _layoutSlots + i });
+			}
+		}
+	}
+
+	void Scope::ReleaseLayout()
+	{
+		if (_layoutSlots != nullptr)
+		{
+			assert(_orderedVector.IsEmpty());
+			_orderedVector = member_vector_type();
+			for (std::size_t i = 0; i < _layout->_names.Size(); ++i)
+			{
+				_layoutSlots[i].~Datum();
+			}
+			::operator delete(_layoutSlots);
+			_layoutSlots = nullptr;
+		}
+		_layout = nullptr;
 	}
 
 	void Scope::Orphan(Scope& child)
 	{
-		auto [datum, index] = FindContainedScope(child);
-		if (datum != nullptr)
+		if (child._parent == this)
 		{
-			datum->RemoveAt(index);
+			Datum& datum = *child._parentDatum;
+			const std::size_t index = child._parentIndex;
+			assert(&datum.GetTable(index) == &child);
+			datum.RemoveAt(index);
+			ClaimChildren(datum, index);
 			child._parent = nullptr;
+			child._parentDatum = nullptr;
+			child.IndexSubtree(nullptr);
+			HierarchyChanged();
+		}
+	}
+
+	void Scope::ClaimChildren(Datum& datum, std::size_t first)
+	{
+		if (datum.Type() == Datum::DatumType::Table)
+		{
+			for (std::size_t i = first; i < datum.Size(); ++i)
+			{
+				Scope& child = datum.GetTable(i);
+				child._parent = this;
+				child._parentDatum = &datum;
+				child._parentIndex = i;
+			}
+		}
+	}
+
+	std::size_t Scope::HierarchyGeneration()
+	{
+		return _hierarchyGeneration.load(std::memory_order_relaxed);
+	}
+
+	void Scope::EnableNameIndex()
+	{
+		if (_parent != nullptr)
+		{
+			throw std::runtime_error("Only a root Scope can own a name index.");
+		}
+
+		if (_nameIndex == nullptr)
+		{
+			IndexSubtree(new NameIndex());
+		}
+	}
+
+	void Scope::DisableNameIndex()
+	{
+		if (OwnsNameIndex())
+		{
+			NameIndex* index = _nameIndex;
+			IndexSubtree(nullptr);
+			delete index;
+		}
+	}
+
+	bool Scope::HasNameIndex() const
+	{
+		return _nameIndex != nullptr;
+	}
+
+	bool Scope::OwnsNameIndex() const
+	{
+		return _parent == nullptr && _nameIndex != nullptr;
+	}
+
+	void Scope::IndexSubtree(NameIndex* index)
+	{
+		if (index == _nameIndex && index == nullptr)
+		{
+			return;
+		}
+
+		for (std::size_t i = 0; i < _orderedVector.Size(); ++i)
+		{
+			const NameId name = _orderedVector[i]._name;
+			Datum& datum = *_orderedVector[i]._datum;
+			if (_nameIndex != nullptr)
+			{
+				_nameIndex->Remove(name, *this);
+			}
+			if (index != nullptr)
+			{
+				index->Add(name, *this, i);
+			}
+
+			if (datum.Type() == Datum::DatumType::Table)
+			{
+				for (std::size_t j = 0; j < datum.Size(); ++j)
+				{
+					datum.GetTable(j).IndexSubtree(index);
+				}
+			}
+		}
+		_nameIndex = index;
+	}
+
+	void Scope::TakeNameIndexFrom(Scope& other)
+	{
+		NameIndex* index = other._nameIndex;
+		if (index == nullptr)
+		{
+			return;
+		}
+
+		// The moved names are still registered under other. An owned index moves over with them,
+		// otherwise this parentless Scope leaves the indexed hierarchy other is still part of.
+		const bool owned = other.OwnsNameIndex();
+		other._nameIndex = nullptr;
+		for (std::size_t i = 0; i < _orderedVector.Size(); ++i)
+		{
+			index->Remove(_orderedVector[i]._name, other);
+			index->Add(_orderedVector[i]._name, *this, i);
+		}
+		_nameIndex = index;
+		if (!owned)
+		{
+			IndexSubtree(nullptr);
 		}
 	}
 
+	std::size_t Scope::StructureGeneration()
+	{
+		return _structureGeneration.load(std::memory_order_relaxed);
+	}
+
+	void Scope::HierarchyChanged()
+	{
+		_hierarchyGeneration.fetch_add(1, std::memory_order_relaxed);
+		_structureGeneration.fetch_add(1, std::memory_order_relaxed);
+	}
+
 	std::size_t Scope::IndexOf(const std::string& name) const
 	{
-		auto it = _unorderedMap.Find(name);
-		if (it == _unorderedMap.cend())
+		NameId id = NameId::Find(name);
+		return id.IsEmpty() ? _orderedVector.Size() : IndexOf(id);
+	}
+
+	std::size_t Scope::IndexOf(NameId name) const
+	{
+		if (_layout != nullptr)
+		{
+			const std::size_t index = _layout->IndexOf(name);
+			if (index < _layout->_names.Size())
+			{
+				return index;
+			}
+		}
+		if (!_unorderedMap.has_value())
+		{
+			return _orderedVector.Size();
+		}
+
+		auto it = _unorderedMap->Find(name);
+		if (it == _unorderedMap->cend())
 		{
 			return _orderedVector.Size();
 		}
-		return _orderedVector.IndexOf(const_cast<std::pair<const std::string, Datum>*>(&(*it)));
+		return (*it).second._index;
 	}
 
 	bool Scope::IsAncestorOf(const Scope& scope) const
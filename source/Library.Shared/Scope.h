@@ -1,10 +1,16 @@
 #pragma once
 #include "RTTI.h"
 #include "Hashmap.h"
+#include "FlatHashmap.h"
 #include "Vector.h"
 #include "Datum.h"
 #include "Factory.h"
+#include "NameId.h"
 #include <gsl/gsl>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <optional>
 
 using namespace std::string_literals;
 
@@ -15,6 +21,54 @@ namespace FieaGameEngine
 		RTTI_DECLARATIONS(Scope, RTTI)
 
 	public:
+		/// <summary>
+		/// Value stored per name: the Datum and its position in insertion order, so IndexOf needs no scan.
+		/// </summary>
+		struct Slot final
+		{
+			Datum _datum;
+			std::size_t _index{ 0 };
+		};
+
+		/// <summary>
+		/// One entry in insertion order, naming its Datum without another lookup.
+		/// </summary>
+		struct Member final
+		{
+			NameId _name;
+			Datum* _datum;
+		};
+
+		/// <summary>
+		/// Storage backing the name lookup. Define FIEA_SCOPE_FLAT_HASHMAP to use the open addressing map.
+		/// Either choice keeps entry references stable, which the ordered vector relies on. Keys are
+		/// interned names, so lookups hash nothing and compare by identity.
+		/// </summary>
+#if defined(FIEA_SCOPE_FLAT_HASHMAP)
+		using map_type = FlatHashmap<NameId, Slot>;
+#else
+		using map_type = Hashmap<NameId, Slot>;
+#endif
+		using pair_type = map_type::pair_type;
+
+		/// <summary>
+		/// Names every instance of one type starts with, built once and shared by all of them.
+		/// An instance built on a Layout holds the Datums for these names in one array, ahead of any
+		/// other entry, and only creates its own map once a name outside the Layout is appended.
+		/// </summary>
+		struct Layout final
+		{
+			explicit Layout(const Vector<NameId>& names);
+
+			/// <summary>
+			/// Returns position of given name in the Layout, or the number of names if it is not in it.
+			/// </summary>
+			std::size_t IndexOf(NameId name) const;
+
+			Vector<NameId> _names;
+			Hashmap<NameId, std::size_t> _indices;
+		};
+
 		/// <summary>
 		/// Default constructor, can be initialized with capacity.
 		/// </summary>
@@ -22,7 +76,8 @@ namespace FieaGameEngine
 
 		/// <summary>
 		/// Copy constructor, constructs Scope from given scope.
-		/// Does not copy the given's parent reference.
+		/// Does not copy the given's parent reference. Nested Scopes are cloned, since each has one
+		/// parent. Heap payloads of other Datums are shared with the given scope until either writes.
 		/// </summary>
 		Scope(const Scope& other);
 
@@ -74,6 +129,11 @@ namespace FieaGameEngine
 		/// </summary>
 		virtual gsl::owner<Scope*> Clone() const;
 
+		/// <summary>
+		/// Reserves room for the given number of entries so bulk appends neither rehash nor reallocate.
+		/// </summary>
+		void Reserve(std::size_t capacity);
+
 		/// <summary>
 		/// Returns address of Datum associated with given key found within this Scope. If not found, nullptr.
 		/// </summary>
@@ -84,6 +144,16 @@ namespace FieaGameEngine
 		/// </summary>
 		const Datum* Find(const std::string& name) const;
 
+		/// <summary>
+		/// Returns address of Datum associated with given interned name within this Scope. If not found, nullptr.
+		/// </summary>
+		Datum* Find(NameId name);
+
+		/// <summary>
+		/// Returns address of const Datum associated with given interned name within this Scope. If not found, nullptr.
+		/// </summary>
+		const Datum* Find(NameId name) const;
+
 		/// <summary>
 		/// Returns address of Datum associated with given key found within this Scope or its ancestors. If not found, nullptr.
 		/// </summary>
@@ -106,11 +176,39 @@ namespace FieaGameEngine
 		/// </summary>
 		const Datum* Search(const std::string& name, const Scope*& foundScope) const;
 
+		/// <summary>
+		/// Returns address of Datum associated with given interned name found within this Scope or its ancestors. If not found, nullptr.
+		/// </summary>
+		Datum* Search(NameId name);
+
+		/// <summary>
+		/// Returns address of const Datum associated with given interned name found within this Scope or its ancestors. If not found, nullptr.
+		/// </summary>
+		const Datum* Search(NameId name) const;
+
+		/// <summary>
+		/// Returns address of Datum associated with given interned name found within this Scope or its ancestors. If not found, nullptr.
+		/// container output parameter will hold address of Scope holding found Datum.
+		/// </summary>
+		Datum* Search(NameId name, Scope*& foundScope);
+
+		/// <summary>
+		/// Returns address of const Datum associated with given interned name found within this Scope or its ancestors. If not found, nullptr.
+		/// container output parameter will hold address of Scope holding found Datum.
+		/// </summary>
+		const Datum* Search(NameId name, const Scope*& foundScope) const;
+
 		/// <summary>
 		/// Returns address of Datum associated with given key found within this Scope or its decendants. If not found, nullptr.
+		/// On the root of an indexed hierarchy, a name held by only one Scope resolves without a scan.
 		/// </summary>
 		std::pair<Scope*, std::size_t> DownSearch(const std::string& name);
 
+		/// <summary>
+		/// Returns address of Datum associated with given interned name found within this Scope or its decendants. If not found, nullptr.
+		/// </summary>
+		std::pair<Scope*, std::size_t> DownSearch(NameId name);
+
 		/// <summary>
 		/// Uses both Search and Find to locate the first datum with this name in full hierarchy.
 		/// </summary>
@@ -133,11 +231,27 @@ namespace FieaGameEngine
 		Datum& Append(const std::string& name, bool& wasInserted);
 
 		/// <summary>
-		/// Returns ref to nested Scope associated with given name within this Scope. 
-		/// If not found, new Scope is created for that name.
+		/// Returns ref to Datum associated with given interned name within this Scope. If not found, new Datum is created for that name.
+		/// Throws if the name is empty.
+		/// </summary>
+		Datum& Append(NameId name);
+
+		/// <summary>
+		/// Returns ref to Datum associated with given interned name within this Scope. If not found, new Datum is created for that name.
+		/// Throws if the name is empty.
+		/// </summary>
+		Datum& Append(NameId name, bool& wasInserted);
+
+		/// <summary>
+		/// Appends a new nested Scope under given name within this Scope and returns ref to it.
 		/// </summary>
 		Scope& AppendScope(const std::string& name);
 
+		/// <summary>
+		/// Appends a new nested Scope under given interned name within this Scope and returns ref to it.
+		/// </summary>
+		Scope& AppendScope(NameId name);
+
 		/// <summary>
 		/// Takes given Scope and adds it as a child to this scope under given name. 
 		/// Removes reference to given scope from its old parent. Throws exception if 
@@ -145,6 +259,13 @@ namespace FieaGameEngine
 		/// </summary>
 		void Adopt(Scope& child, const std::string& name);
 
+		/// <summary>
+		/// Takes given Scope and adds it as a child to this scope under given interned name. 
+		/// Removes reference to given scope from its old parent. Throws exception if 
+		/// name exists already with different Datum type.
+		/// </summary>
+		void Adopt(Scope& child, NameId name);
+
 		/// <summary>
 		/// Get address of Scope's parent, nullptr if it has none.
 		/// </summary>
@@ -160,6 +281,16 @@ namespace FieaGameEngine
 		/// </summary>
 		const Datum& operator[](const std::string& name) const;
 
+		/// <summary>
+		/// Calls Append.
+		/// </summary>
+		Datum& operator[](NameId name);
+
+		/// <summary>
+		/// Returns Datum ref if found, throws exception if not found.
+		/// </summary>
+		const Datum& operator[](NameId name) const;
+
 		/// <summary>
 		/// Returns ref to Datum at given index. Indices correspond to order of insert.
 		/// </summary>
@@ -170,9 +301,20 @@ namespace FieaGameEngine
 		/// </summary>
 		const Datum& operator[](std::size_t index) const;
 
+		/// <summary>
+		/// Returns every entry in insertion order. Appending a new name or clearing invalidates the span.
+		/// </summary>
+		gsl::span<const Member> Members() const;
+
+		/// <summary>
+		/// Returns interned name of the entry at given index. Indices correspond to order of insert.
+		/// Throws if index is out of range.
+		/// </summary>
+		NameId NameAt(std::size_t index) const;
+
 		/// <summary>
 		/// Returns Datum holding found Scope with given address and index within Datum at 
-		/// which Scope is located.
+		/// which Scope is located. Compares addresses only, so given Scope is never dereferenced.
 		/// </summary>
 		std::pair<Datum*, std::size_t> FindContainedScope(const Scope& scope) const;
 
@@ -182,11 +324,45 @@ namespace FieaGameEngine
 		virtual void Clear();
 
 		/// <summary>
-		/// Removes child Scope from this Scope.
+		/// Removes child Scope from this Scope. The child knows the Datum slot holding it, so no search
+		/// is needed. Only the later siblings in that Datum shift down. Does nothing if this is not the child's parent.
 		/// </summary>
 		/// <param name="child"></param>
 		void Orphan(Scope& child);
 
+		/// <summary>
+		/// Builds a name index over this root Scope and all its descendants, kept up to date by Append,
+		/// Adopt, Orphan and Clear, so DownSearch from this Scope resolves unique names in constant time.
+		/// The index is dropped when this Scope is adopted. Throws if this Scope has a parent.
+		/// </summary>
+		void EnableNameIndex();
+
+		/// <summary>
+		/// Drops the name index owned by this root Scope, if any.
+		/// </summary>
+		void DisableNameIndex();
+
+		/// <summary>
+		/// Returns whether this Scope belongs to a hierarchy whose root owns a name index.
+		/// </summary>
+		bool HasNameIndex() const;
+
+		/// <summary>
+		/// Returns a counter bumped whenever a Scope already in a hierarchy gains or loses a nested Scope:
+		/// through Adopt, Orphan, Clear of a Scope with nested Scopes, assignment, moving nested Scopes
+		/// out of a Scope, or AppendScope on a Scope that has a parent. Copying, or building a Scope that
+		/// is attached to nothing, leaves it alone. Caches built over a hierarchy compare it to know when
+		/// they must be rebuilt. Safe to read while other threads bump it.
+		/// </summary>
+		static std::size_t HierarchyGeneration();
+
+		/// <summary>
+		/// Returns a counter bumped whenever HierarchyGeneration is, and also whenever any Scope gains a
+		/// new name or is cleared. While it is unchanged, every name lookup resolves to the same Datum,
+		/// so a cached lookup result may be reused. Safe to read while other threads append.
+		/// </summary>
+		static std::size_t StructureGeneration();
+
 		/// <summary>
 		/// ToString override for Scope.
 		/// </summary>
@@ -196,15 +372,114 @@ namespace FieaGameEngine
 		}
 
 	protected:
+		/// <summary>
+		/// Constructs a Scope holding an empty Datum for every name in given Layout, which must outlive it.
+		/// </summary>
+		explicit Scope(const Layout& layout);
+
 		std::size_t IndexOf(const std::string& name) const;
+		std::size_t IndexOf(NameId name) const;
 
 	private:
+		static constexpr std::size_t DefaultCapacity = 11;
+
+		/// <summary>
+		/// Allocator of the ordered vector. The first request that fits is served from the Member array
+		/// placed after the Layout slots, so a Scope built on a Layout costs a single allocation.
+		/// Anything else goes to the heap.
+		/// </summary>
+		struct MemberAllocator final
+		{
+			void* Allocate(std::size_t bytes)
+			{
+				if (!_isReservedInUse && _reserved != nullptr && bytes <= _reservedBytes)
+				{
+					_isReservedInUse = true;
+					return _reserved;
+				}
+				return DefaultAllocator{}.Allocate(bytes);
+			}
+
+			void* Reallocate(void* memory, std::size_t bytes)
+			{
+				if (memory == nullptr)
+				{
+					return Allocate(bytes);
+				}
+				if (memory != _reserved)
+				{
+					return DefaultAllocator{}.Reallocate(memory, bytes);
+				}
+				void* moved = DefaultAllocator{}.Allocate(bytes);
+				std::memcpy(moved, memory, std::min(bytes, _reservedBytes));
+				_isReservedInUse = false;
+				return moved;
+			}
+
+			void Deallocate(void* memory)
+			{
+				if (memory != nullptr && memory == _reserved)
+				{
+					_isReservedInUse = false;
+				}
+				else
+				{
+					DefaultAllocator{}.Deallocate(memory);
+				}
+			}
+
+			bool operator==(const MemberAllocator& rhs) const { return _reserved == rhs._reserved; }
+			bool operator!=(const MemberAllocator& rhs) const { return _reserved != rhs._reserved; }
+
+			void* _reserved{ nullptr };
+			std::size_t _reservedBytes{ 0 };
+			bool _isReservedInUse{ false };
+		};
+
+		using member_vector_type = Vector<Member, IncrementFunctor, MemberAllocator>;
+
+		/// <summary>
+		/// Gives this empty Scope the slots of given Layout, if any, constructed in one block that also
+		/// holds the ordered vector's first Member array.
+		/// </summary>
+		void UseLayout(const Layout* layout);
+
+		/// <summary>
+		/// Destroys the Layout slots and frees their block. The ordered vector must no longer refer to them.
+		/// </summary>
+		void ReleaseLayout();
+
 		bool IsAncestorOf(const Scope& scope) const;
 		bool IsDescendantOf(const Scope& scope) const;
 
+		struct NameIndex;
+
+		/// <summary>
+		/// Moves every name of this Scope and its descendants from their current index to given one.
+		/// </summary>
+		void IndexSubtree(NameIndex* index);
+		void TakeNameIndexFrom(Scope& other);
+		bool OwnsNameIndex() const;
+
+		/// <summary>
+		/// Makes this Scope the parent of the nested Scopes at or after given index in given Datum and
+		/// records where each one is held.
+		/// </summary>
+		void ClaimChildren(Datum& datum, std::size_t first = 0);
+
+		static void HierarchyChanged();
+
+		static std::atomic<std::size_t> _hierarchyGeneration;
+		static std::atomic<std::size_t> _structureGeneration;
+
 		Scope* _parent{ nullptr };
-		Hashmap<std::string, Datum> _unorderedMap;
-		Vector<typename Hashmap<std::string, Datum>::pair_type*> _orderedVector;
+		Datum* _parentDatum{ nullptr };
+		std::size_t _parentIndex{ 0 };
+		const Layout* _layout{ nullptr };
+		Datum* _layoutSlots{ nullptr };
+		std::optional<map_type> _unorderedMap;
+		member_vector_type _orderedVector;
+		NameIndex* _nameIndex{ nullptr };
 	};
 
 	ConcreteFactory(Scope, RTTI)
@@ -1,13 +1,64 @@
 #pragma once
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
 #include "Datum.h"
 
 namespace FieaGameEngine
 {
+	/// <summary>
+	/// Maps a data member's element type to the Datum type that can hold it externally.
+	/// </summary>
+	template <typename T>
+	struct DatumTypeOf
+	{
+		static_assert(!std::is_same_v<T, T>, "Data member type cannot be held by a Datum.");
+	};
+
+	template <> struct DatumTypeOf<int> { static constexpr Datum::DatumType Value = Datum::DatumType::Integer; };
+	template <> struct DatumTypeOf<float> { static constexpr Datum::DatumType Value = Datum::DatumType::Float; };
+	template <> struct DatumTypeOf<std::string> { static constexpr Datum::DatumType Value = Datum::DatumType::String; };
+	template <> struct DatumTypeOf<glm::vec4> { static constexpr Datum::DatumType Value = Datum::DatumType::Vector; };
+	template <> struct DatumTypeOf<glm::mat4> { static constexpr Datum::DatumType Value = Datum::DatumType::Matrix; };
+	template <> struct DatumTypeOf<RTTI*> { static constexpr Datum::DatumType Value = Datum::DatumType::Pointer; };
+
+	/// <summary>
+	/// Describes one prescribed attribute. A type lists its own Signatures in a static constexpr array,
+	/// so the table is built by the compiler and registering it allocates nothing per Signature.
+	/// </summary>
 	struct Signature final
 	{
-		std::string _name;
+		std::string_view _name;
 		Datum::DatumType _type;
 		std::size_t _count;
 		std::size_t _offset;
+
+		/// <summary>
+		/// Returns the Signature of a data member of type TMember at given offset. The Datum type and
+		/// count come from TMember itself, so an array member gets its extent as count, and a member
+		/// a Datum cannot hold fails to compile. Use SIGNATURE_OF to pair the type and offset.
+		/// </summary>
+		template <typename TMember>
+		static constexpr Signature Of(std::string_view name, std::size_t offset)
+		{
+			using element_type = std::remove_cv_t<std::remove_all_extents_t<TMember>>;
+			static_assert(std::rank_v<TMember> <= 1, "Multidimensional arrays cannot be prescribed attributes.");
+			constexpr std::size_t count = std::rank_v<TMember> == 1 ? std::extent_v<TMember> : 1;
+			return Signature{ name, DatumTypeOf<element_type>::Value, count, offset };
+		}
+
+		/// <summary>
+		/// Returns the Signature of a nested Scope attribute, created with given number of empty Scopes.
+		/// </summary>
+		static constexpr Signature Table(std::string_view name, std::size_t count = 0)
+		{
+			return Signature{ name, Datum::DatumType::Table, count, 0 };
+		}
 	};
-}
\ No newline at end of file
+}
+
+/// <summary>
+/// Signature of given data member of Type, with its type and offset taken from the same member.
+/// Expands inside a member function of Type, so private members are accessible.
+/// </summary>
+#define SIGNATURE_OF(Type, Member, Name) FieaGameEngine::Signature::Of<decltype(Type::Member)>(Name, offsetof(Type, Member))
\ No newline at end of file
@@ -19,7 +19,11 @@ namespace FieaGameEngine
 		void Clear();
 
 	private:
-		SList<T> _list;
+		/// <summary>
+		/// Pushes and pops recycle nodes through a pool owned with the list, so a stack that is
+		/// repeatedly filled and drained (such as a parse context stack) stops allocating once warm.
+		/// </summary>
+		SList<T> _list{ std::make_shared<typename SList<T>::NodePool>(8) };
 	};
 }
 
@@ -0,0 +1,152 @@
+#include "pch.h"
+#include "TransformStore.h"
+#include <algorithm>
+#include <memory>
+
+namespace FieaGameEngine
+{
+	TransformStore::~TransformStore()
+	{
+		assert(Size() == 0);
+		for (Page* page : _pages)
+		{
+			delete page;
+		}
+	}
+
+	TransformStore::Handle TransformStore::Acquire()
+	{
+		Handle handle;
+		if (!_freeHandles.IsEmpty())
+		{
+			handle = _freeHandles.Back();
+			_freeHandles.PopBack();
+		}
+		else
+		{
+			if (_slotCount == _pages.Size() * PageCapacity)
+			{
+				auto page = std::make_unique<Page>();
+				_pages.PushBack(page.get());
+				page.release();
+			}
+			handle = _slotCount++;
+		}
+
+		Page& page = *_pages[handle / PageCapacity];
+		const std::size_t slot = handle % PageCapacity;
+		page.Positions[slot] = glm::vec4(0);
+		page.Rotations[slot] = glm::vec4(0);
+		page.Scales[slot] = glm::vec4(0);
+		page.Held[slot] = true;
+		return handle;
+	}
+
+	void TransformStore::Release(Handle handle)
+	{
+		Page& page = const_cast<Page&>(PageOf(handle));
+		const std::size_t slot = handle % PageCapacity;
+		assert(page.Held[slot]);
+		_freeHandles.PushBack(handle);
+		page.Held[slot] = false;
+	}
+
+	std::size_t TransformStore::Size() const
+	{
+		return _slotCount - _freeHandles.Size();
+	}
+
+	std::size_t TransformStore::SlotCount() const
+	{
+		return _slotCount;
+	}
+
+	std::size_t TransformStore::PageCount() const
+	{
+		return _pages.Size();
+	}
+
+	glm::vec4& TransformStore::Position(Handle handle)
+	{
+		return const_cast<glm::vec4&>(const_cast<const TransformStore*>(this)->Position(handle));
+	}
+
+	const glm::vec4& TransformStore::Position(Handle handle) const
+	{
+		return PageOf(handle).Positions[handle % PageCapacity];
+	}
+
+	glm::vec4& TransformStore::Rotation(Handle handle)
+	{
+		return const_cast<glm::vec4&>(const_cast<const TransformStore*>(this)->Rotation(handle));
+	}
+
+	const glm::vec4& TransformStore::Rotation(Handle handle) const
+	{
+		return PageOf(handle).Rotations[handle % PageCapacity];
+	}
+
+	glm::vec4& TransformStore::Scale(Handle handle)
+	{
+		return const_cast<glm::vec4&>(const_cast<const TransformStore*>(this)->Scale(handle));
+	}
+
+	const glm::vec4& TransformStore::Scale(Handle handle) const
+	{
+		return PageOf(handle).Scales[handle % PageCapacity];
+	}
+
+	gsl::span<glm::vec4> TransformStore::Positions(std::size_t page)
+	{
+		const std::size_t size = PageSize(page);
+		return gsl::span<glm::vec4>(_pages[page]->Positions, size);
+	}
+
+	gsl::span<const glm::vec4> TransformStore::Positions(std::size_t page) const
+	{
+		const std::size_t size = PageSize(page);
+		return gsl::span<const glm::vec4>(_pages[page]->Positions, size);
+	}
+
+	gsl::span<glm::vec4> TransformStore::Rotations(std::size_t page)
+	{
+		const std::size_t size = PageSize(page);
+		return gsl::span<glm::vec4>(_pages[page]->Rotations, size);
+	}
+
+	gsl::span<const glm::vec4> TransformStore::Rotations(std::size_t page) const
+	{
+		const std::size_t size = PageSize(page);
+		return gsl::span<const glm::vec4>(_pages[page]->Rotations, size);
+	}
+
+	gsl::span<glm::vec4> TransformStore::Scales(std::size_t page)
+	{
+		const std::size_t size = PageSize(page);
+		return gsl::span<glm::vec4>(_pages[page]->Scales, size);
+	}
+
+	gsl::span<const glm::vec4> TransformStore::Scales(std::size_t page) const
+	{
+		const std::size_t size = PageSize(page);
+		return gsl::span<const glm::vec4>(_pages[page]->Scales, size);
+	}
+
+	const TransformStore::Page& TransformStore::PageOf(Handle handle) const
+	{
+		if (handle >= _slotCount)
+		{
+			throw std::out_of_range("Transform handle was never acquired from this store.");
+		}
+		return *_pages[handle / PageCapacity];
+	}
+
+	std::size_t TransformStore::PageSize(std::size_t page) const
+	{
+		if (page >= _pages.Size())
+		{
+			throw std::out_of_range("Transform page index out of range.");
+		}
+		return std::min(PageCapacity, _slotCount - page * PageCapacity);
+	}
+}
@@ -0,0 +1,117 @@
+#pragma once
+#include <cstddef>
+#include <limits>
+#include <glm\glm.hpp>
+#include <gsl/gsl>
+#include "Vector.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Structure of arrays storage for GameObject transforms. Positions, rotations and scales each live
+	/// in their own contiguous vec4 arrays, split into fixed size pages that are never moved, so a slot
+	/// keeps its address for as long as its handle is held and Datums bound to it never dangle.
+	/// Released slots are handed out again by later Acquire calls.
+	/// Batch updates walk the store a page at a time through Positions, Rotations and Scales, whose
+	/// spans can be passed straight to DatumKernels.
+	/// The store must outlive every GameObject bound to it.
+	/// </summary>
+	class TransformStore final
+	{
+	public:
+		using Handle = std::size_t;
+		static constexpr Handle InvalidHandle = std::numeric_limits<Handle>::max();
+		static constexpr std::size_t PageCapacity = 1024;
+
+		TransformStore() = default;
+		TransformStore(const TransformStore&) = delete;
+		TransformStore(TransformStore&&) = delete;
+		TransformStore& operator=(const TransformStore&) = delete;
+		TransformStore& operator=(TransformStore&&) = delete;
+
+		/// <summary>
+		/// Frees every page. Asserts that no slots are still held.
+		/// </summary>
+		~TransformStore();
+
+		/// <summary>
+		/// Returns a handle to a slot with position, rotation and scale zeroed.
+		/// Reuses the most recently released slot if there is one.
+		/// </summary>
+		Handle Acquire();
+
+		/// <summary>
+		/// Returns the slot to the store. Throws std::out_of_range if handle was never acquired,
+		/// and asserts that it is not already released.
+		/// </summary>
+		void Release(Handle handle);
+
+		/// <summary>
+		/// Returns number of slots currently held.
+		/// </summary>
+		std::size_t Size() const;
+
+		/// <summary>
+		/// Returns number of slots ever handed out, held or released. Handles are always below this.
+		/// </summary>
+		std::size_t SlotCount() const;
+
+		/// <summary>
+		/// Returns number of pages backing the store.
+		/// </summary>
+		std::size_t PageCount() const;
+
+		/// <summary>
+		/// Returns position held in given slot. Throws std::out_of_range if handle was never acquired.
+		/// </summary>
+		glm::vec4& Position(Handle handle);
+		const glm::vec4& Position(Handle handle) const;
+
+		/// <summary>
+		/// Returns rotation held in given slot. Throws std::out_of_range if handle was never acquired.
+		/// </summary>
+		glm::vec4& Rotation(Handle handle);
+		const glm::vec4& Rotation(Handle handle) const;
+
+		/// <summary>
+		/// Returns scale held in given slot. Throws std::out_of_range if handle was never acquired.
+		/// </summary>
+		glm::vec4& Scale(Handle handle);
+		const glm::vec4& Scale(Handle handle) const;
+
+		/// <summary>
+		/// Returns the positions of the slots on given page. Released slots are included, so batch
+		/// updates may touch them harmlessly. Throws std::out_of_range if page is out of range.
+		/// </summary>
+		gsl::span<glm::vec4> Positions(std::size_t page);
+		gsl::span<const glm::vec4> Positions(std::size_t page) const;
+
+		/// <summary>
+		/// Returns the rotations of the slots on given page, see Positions.
+		/// </summary>
+		gsl::span<glm::vec4> Rotations(std::size_t page);
+		gsl::span<const glm::vec4> Rotations(std::size_t page) const;
+
+		/// <summary>
+		/// Returns the scales of the slots on given page, see Positions.
+		/// </summary>
+		gsl::span<glm::vec4> Scales(std::size_t page);
+		gsl::span<const glm::vec4> Scales(std::size_t page) const;
+
+	private:
+		struct Page final
+		{
+			glm::vec4 Positions[PageCapacity];
+			glm::vec4 Rotations[PageCapacity];
+			glm::vec4 Scales[PageCapacity];
+			bool Held[PageCapacity];
+		};
+
+		const Page& PageOf(Handle handle) const;
+		std::size_t PageSize(std::size_t page) const;
+
+		Vector<Page*> _pages;
+		Vector<Handle> _freeHandles;
+		std::size_t _slotCount{ 0 };
+	};
+}
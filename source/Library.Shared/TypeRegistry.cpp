@@ -9,8 +9,36 @@ namespace FieaGameEngine
 		return instance;
 	}
 
-	const Vector<Signature>& TypeRegistry::GetSignaturesOfType(RTTI::IdType id) const
+	const TypeRegistry::RegisteredType& TypeRegistry::GetType(RTTI::IdType id) const
 	{
 		return _types.At(id);
 	}
+
+	const Vector<const Signature*>& TypeRegistry::GetSignaturesOfType(RTTI::IdType id) const
+	{
+		return _types.At(id)._signatures;
+	}
+
+	const Scope::Layout& TypeRegistry::GetLayoutOfType(RTTI::IdType id) const
+	{
+		return _types.At(id)._layout;
+	}
+
+	void TypeRegistry::InsertType(RTTI::IdType id, Vector<const Signature*>&& signatures)
+	{
+		if (_types.ContainsKey(id))
+		{
+			return;
+		}
+
+		Vector<NameId> names(signatures.Size() + 1);
+		names.PushBack(NameId("this"s));
+		for (const Signature* signature : signatures)
+		{
+			names.PushBack(NameId(std::string(signature->_name)));
+		}
+		std::pair<RTTI::IdType, const RegisteredType> entry =
+			std::make_pair(id, RegisteredType{ std::move(signatures), Scope::Layout(names) });
+		_types.Insert(entry);
+	}
 }
\ No newline at end of file
@@ -3,15 +3,26 @@
 #include "Vector.h"
 #include "RTTI.h"
 #include "Signature.h"
+#include "Scope.h"
 
 namespace FieaGameEngine
 {
 	/// <summary>
-	/// Container of Vectors of Signatures for registered types.
+	/// Container of the Signatures of registered types, and of the Scope layout
+	/// every instance of a registered type shares.
 	/// </summary>
 	class TypeRegistry final
 	{
 	public:
+		/// <summary>
+		/// Everything registered for one type, so constructing an instance needs a single lookup.
+		/// </summary>
+		struct RegisteredType final
+		{
+			Vector<const Signature*> _signatures;
+			Scope::Layout _layout;
+		};
+
 		TypeRegistry(const TypeRegistry& other) = delete;
 
 		/// <summary>
@@ -21,25 +32,66 @@ namespace FieaGameEngine
 		static TypeRegistry& GetInstance();
 
 		/// <summary>
-		/// Adds all signatures of given type to the registry. Type must have 
-		/// a Signatures() method that gives Vector of Signature objects
+		/// Adds all signatures of given type to the registry. Type must have a static Signatures()
+		/// method returning a span over its own Signatures, kept in a static array. If its parent
+		/// type has one too, the parent is registered first and its Signatures come first.
 		/// </summary>
 		template<typename TType>
 		void RegisterSignaturesOfType()
 		{
-			std::pair<RTTI::IdType, const Vector<Signature>> entry = 
-				std::make_pair(TType::TypeIdClass(), TType::Signatures());
-			_types.Insert(entry);
+			Vector<const Signature*> signatures;
+			using parent_type = typename TType::Base;
+			if constexpr (HasSignatures<parent_type>::value)
+			{
+				RegisterSignaturesOfType<parent_type>();
+				signatures = GetSignaturesOfType(parent_type::TypeIdClass());
+				if (&TType::Signatures == &parent_type::Signatures)
+				{
+					InsertType(TType::TypeIdClass(), std::move(signatures));
+					return;
+				}
+			}
+
+			gsl::span<const Signature> own = TType::Signatures();
+			signatures.Reserve(signatures.Size() + own.size());
+			for (const Signature& signature : own)
+			{
+				signatures.PushBack(&signature);
+			}
+			InsertType(TType::TypeIdClass(), std::move(signatures));
 		}
 
 		/// <summary>
-		/// Returns Vector of Signature ref for the type. Throws exception if type ID
+		/// Returns the Signatures and layout registered for the type. Throws exception if type ID
+		/// does not exist in registry.
+		/// </summary>
+		const RegisteredType& GetType(RTTI::IdType id) const;
+
+		/// <summary>
+		/// Returns the Signatures of the type, inherited ones first. Throws exception if type ID
 		/// does not exist in registry.
 		/// </summary>
-		const Vector<Signature>& GetSignaturesOfType(RTTI::IdType id) const;
+		const Vector<const Signature*>& GetSignaturesOfType(RTTI::IdType id) const;
+
+		/// <summary>
+		/// Returns the layout shared by every instance of the type: "this" followed by the name of
+		/// each Signature, in order. Throws exception if type ID does not exist in registry.
+		/// </summary>
+		const Scope::Layout& GetLayoutOfType(RTTI::IdType id) const;
 
 	private:
-		Hashmap<RTTI::IdType, const Vector<Signature>> _types;
+		template <typename T, typename = void>
+		struct HasSignatures : std::false_type {};
+
+		template <typename T>
+		struct HasSignatures<T, std::void_t<decltype(T::Signatures())>> : std::true_type {};
+
+		/// <summary>
+		/// Builds the layout for given Signatures and stores both, unless the type is already registered.
+		/// </summary>
+		void InsertType(RTTI::IdType id, Vector<const Signature*>&& signatures);
+
+		Hashmap<RTTI::IdType, const RegisteredType> _types;
 		TypeRegistry() = default;
 	};
 }
\ No newline at end of file
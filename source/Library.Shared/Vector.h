@@ -1,28 +1,44 @@
 #pragma once
 #include <cstddef>
+#include <cstring>
 #include <stdexcept>
 #include <functional>
+#include <type_traits>
+#include <utility>
 #include <cassert>
 #include "IncrementFunctor.h"
+#include "DefaultAllocator.h"
 
 namespace FieaGameEngine
 {
+	/// <summary>
+	/// Whether a T can be moved to a new address by copying its bytes and forgetting the original.
+	/// Vector grows such types with a single reallocation instead of element by element moves.
+	/// Specialize to true_type for types that hold no pointers into themselves.
+	/// </summary>
+	template <typename T>
+	struct IsTriviallyRelocatable : std::is_trivially_copyable<T> {};
+
 	/// <summary>
 	/// Resizable container of items stored in contiguous memory.
 	/// </summary>
 	/// <typeparam name="T">Data type.</typeparam>
-	template <typename T>
+	/// <typeparam name="TGrowthPolicy">Maps (size, capacity) to the capacity to grow to when full.</typeparam>
+	/// <typeparam name="TAllocator">Source of the element storage, see DefaultAllocator.</typeparam>
+	template <typename T, typename TGrowthPolicy = IncrementFunctor, typename TAllocator = DefaultAllocator>
 	class Vector final
 	{
 	public:
 		using value_type = T;
+		using growth_policy_type = TGrowthPolicy;
+		using allocator_type = TAllocator;
 
 		/// <summary>
 		/// Used to traverse and mutate items in a non const Vector.
 		/// </summary>
 		class Iterator
 		{
-			friend class Vector<T>;
+			friend class Vector;
 
 		public:
 			//using iterator_category = std::random_access_iterator_tag;
@@ -111,7 +127,7 @@ namespace FieaGameEngine
 		/// </summary>
 		class ConstIterator
 		{
-			friend class Vector<T>;
+			friend class Vector;
 
 		public:
 			//using iterator_category = std::random_access_iterator_tag;
@@ -196,10 +212,9 @@ namespace FieaGameEngine
 
 		/// <summary>
 		/// Default Vector constructor. Capacity set to 0 as default.
-		/// User can supply a functor for determining how capacity is increased based on current size and capacity
+		/// How capacity grows is decided at compile time by TGrowthPolicy.
 		/// </summary>
-		Vector(std::size_t capacity = 0, 
-			std::function<std::size_t(std::size_t size, std::size_t capacity)> reserveFunctor = IncrementFunctor{});
+		Vector(std::size_t capacity = 0, const TAllocator& allocator = TAllocator{});
 
 		/// <summary>
 		/// Copy constructor. Create Vector instance from other Vector instance.
@@ -211,11 +226,10 @@ namespace FieaGameEngine
 		/// Instantiate Vector from initializer list.
 		/// </summary>
 		/// <param name="list">Init list of data to insert.</param>
-		Vector(std::initializer_list<T> list, 
-			std::function<std::size_t(std::size_t size, std::size_t capacity)> reserveFunctor = IncrementFunctor{});
+		Vector(std::initializer_list<T> list, const TAllocator& allocator = TAllocator{});
 		
 		/// <summary>
-		/// Move constructor. Shallow copy memory of given into this instance.
+		/// Move constructor. Takes the storage of given, leaving it empty.
 		/// </summary>
 		/// <param name="other">Given R value vector.</param>
 		Vector(Vector&& other) noexcept;
@@ -238,7 +252,7 @@ namespace FieaGameEngine
 		Vector& operator=(const std::initializer_list<T> list);
 		
 		/// <summary>
-		/// Move Assignment Operator. Shallow copies given vector into lhs vector.
+		/// Move Assignment Operator. Takes the storage and allocator of given, leaving it empty.
 		/// </summary>
 		/// <param name="other">Given R value vector.</param>
 		/// <returns>Vector reference.</returns>
@@ -359,11 +373,19 @@ namespace FieaGameEngine
 		void PushBack(const T& data);
 
 		/// <summary>
-		/// Adds given data within Rvalue reference to the back of the Vector.
+		/// Moves given data within Rvalue reference to the back of the Vector.
 		/// </summary>
 		/// <param name="data">Data to be added.</param>
 		void PushBack(T&& data);
 
+		/// <summary>
+		/// Constructs a new item in place at the back of the Vector from the given arguments.
+		/// Arguments may refer to items already in the Vector.
+		/// </summary>
+		/// <returns>Reference to the new item.</returns>
+		template <typename... Args>
+		T& EmplaceBack(Args&&... args);
+
 		/// <summary>
 		/// Reserves given amount of memory space for Vector. 
 		/// Given capacity cannot be lower than current capacity.
@@ -436,11 +458,22 @@ namespace FieaGameEngine
 		/// </summary>
 		std::size_t IndexOf(const T& value) const;
 
+		/// <summary>
+		/// Returns the allocator providing this Vector's storage.
+		/// </summary>
+		const TAllocator& GetAllocator() const;
+
 	private:
+		inline static constexpr bool Relocatable = IsTriviallyRelocatable<T>::value;
+
+		void Reallocate(std::size_t newCapacity);
+		void Release();
+		std::size_t NextCapacity() const;
+
 		T* arrayPtr{ nullptr };
 		std::size_t size{ 0 };
 		std::size_t capacity{ 0 };
-		std::function<std::size_t(std::size_t, std::size_t)> reserveFunctor;
+		TAllocator allocator;
 	};
 }
 
@@ -2,26 +2,26 @@
 
 namespace FieaGameEngine
 {
-	template<typename T>
-	Vector<T>::Iterator::Iterator(Vector& owner, std::size_t index) :
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	Vector<T, TGrowthPolicy, TAllocator>::Iterator::Iterator(Vector& owner, std::size_t index) :
 		owner(&owner), index(index)
 	{
 	}
 
-	template<typename T>
-	bool Vector<T>::Iterator::operator==(const Iterator& rhs) const
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	bool Vector<T, TGrowthPolicy, TAllocator>::Iterator::operator==(const Iterator& rhs) const
 	{
 		return !operator!=(rhs);
 	}
 
-	template<typename T>
-	bool Vector<T>::Iterator::operator!=(const Iterator& rhs) const
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	bool Vector<T, TGrowthPolicy, TAllocator>::Iterator::operator!=(const Iterator& rhs) const
 	{
 		return owner != rhs.owner || index != rhs.index;
 	}
 
-	template<typename T>
-	typename Vector<T>::Iterator& Vector<T>::Iterator::operator++()
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	typename Vector<T, TGrowthPolicy, TAllocator>::Iterator& Vector<T, TGrowthPolicy, TAllocator>::Iterator::operator++()
 	{
 		if (owner == nullptr)
 		{
@@ -35,16 +35,16 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template<typename T>
-	typename Vector<T>::Iterator Vector<T>::Iterator::operator++(int)
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	typename Vector<T, TGrowthPolicy, TAllocator>::Iterator Vector<T, TGrowthPolicy, TAllocator>::Iterator::operator++(int)
 	{
 		Iterator temp = *this;
 		++(*this);
 		return temp;
 	}
 
-	template<typename T>
-	typename Vector<T>::Iterator& Vector<T>::Iterator::operator--()
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	typename Vector<T, TGrowthPolicy, TAllocator>::Iterator& Vector<T, TGrowthPolicy, TAllocator>::Iterator::operator--()
 	{
 		if (owner == nullptr)
 		{
@@ -57,16 +57,16 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template<typename T>
-	typename Vector<T>::Iterator Vector<T>::Iterator::operator--(int)
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	typename Vector<T, TGrowthPolicy, TAllocator>::Iterator Vector<T, TGrowthPolicy, TAllocator>::Iterator::operator--(int)
 	{
 		Iterator temp = *this;
 		--(*this);
 		return temp;
 	}
 
-	template<typename T>
-	inline T& Vector<T>::Iterator::operator*() const
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	inline T& Vector<T, TGrowthPolicy, TAllocator>::Iterator::operator*() const
 	{
 		if (owner == nullptr)
 		{
@@ -79,32 +79,32 @@ namespace FieaGameEngine
 		return owner->arrayPtr[index];
 	}
 
-	template<typename T>
-	Vector<T>::ConstIterator::ConstIterator(const Vector& owner, std::size_t index) :
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	Vector<T, TGrowthPolicy, TAllocator>::ConstIterator::ConstIterator(const Vector& owner, std::size_t index) :
 		owner(&owner), index(index)
 	{
 	}
 
-	template<typename T>
-	Vector<T>::ConstIterator::ConstIterator(const Iterator& other) :
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	Vector<T, TGrowthPolicy, TAllocator>::ConstIterator::ConstIterator(const Iterator& other) :
 		owner(other.owner), index(other.index)
 	{
 	}
 
-	template<typename T>
-	bool Vector<T>::ConstIterator::operator==(const ConstIterator& rhs) const
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	bool Vector<T, TGrowthPolicy, TAllocator>::ConstIterator::operator==(const ConstIterator& rhs) const
 	{
 		return !operator!=(rhs);
 	}
 
-	template<typename T>
-	bool Vector<T>::ConstIterator::operator!=(const ConstIterator& rhs) const
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	bool Vector<T, TGrowthPolicy, TAllocator>::ConstIterator::operator!=(const ConstIterator& rhs) const
 	{
 		return owner != rhs.owner || index != rhs.index;
 	}
 
-	template<typename T>
-	typename Vector<T>::ConstIterator& Vector<T>::ConstIterator::operator++()
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	typename Vector<T, TGrowthPolicy, TAllocator>::ConstIterator& Vector<T, TGrowthPolicy, TAllocator>::ConstIterator::operator++()
 	{
 		if (owner == nullptr)
 		{
@@ -118,16 +118,16 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template<typename T>
-	typename Vector<T>::ConstIterator Vector<T>::ConstIterator::operator++(int)
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	typename Vector<T, TGrowthPolicy, TAllocator>::ConstIterator Vector<T, TGrowthPolicy, TAllocator>::ConstIterator::operator++(int)
 	{
 		ConstIterator temp = *this;
 		++(*this);
 		return temp;
 	}
 
-	template<typename T>
-	typename Vector<T>::ConstIterator& Vector<T>::ConstIterator::operator--()
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	typename Vector<T, TGrowthPolicy, TAllocator>::ConstIterator& Vector<T, TGrowthPolicy, TAllocator>::ConstIterator::operator--()
 	{
 		if (owner == nullptr)
 		{
@@ -140,16 +140,16 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template<typename T>
-	typename Vector<T>::ConstIterator Vector<T>::ConstIterator::operator--(int)
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	typename Vector<T, TGrowthPolicy, TAllocator>::ConstIterator Vector<T, TGrowthPolicy, TAllocator>::ConstIterator::operator--(int)
 	{
 		ConstIterator temp = *this;
 		--(*this);
 		return temp;
 	}
 
-	template<typename T>
-	inline const T& Vector<T>::ConstIterator::operator*() const
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	inline const T& Vector<T, TGrowthPolicy, TAllocator>::ConstIterator::operator*() const
 	{
 		if (owner == nullptr)
 		{
@@ -162,10 +162,9 @@ namespace FieaGameEngine
 		return owner->arrayPtr[index];
 	}
 
-	template<typename T>
-	Vector<T>::Vector(std::size_t capacity, 
-		std::function<std::size_t(std::size_t size, std::size_t capacity)> reserveFunctor) :
-		reserveFunctor(reserveFunctor)
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	Vector<T, TGrowthPolicy, TAllocator>::Vector(std::size_t capacity, const TAllocator& allocator) :
+		allocator(allocator)
 	{
 		if (capacity > 0)
 		{
@@ -173,9 +172,9 @@ namespace FieaGameEngine
 		}
 	}
 
-	template<typename T>
-	Vector<T>::Vector(const Vector& other) :
-		reserveFunctor(other.reserveFunctor)
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	Vector<T, TGrowthPolicy, TAllocator>::Vector(const Vector& other) :
+		allocator(other.allocator)
 	{
 		Reserve(other.capacity);
 		for (auto it = other.cbegin(); it != other.cend(); ++it)
@@ -184,9 +183,9 @@ namespace FieaGameEngine
 		}
 	}
 
-	template<typename T>
-	Vector<T>::Vector(std::initializer_list<T> list, 
-		std::function<std::size_t(std::size_t size, std::size_t capacity)> reserveFunctor)
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	Vector<T, TGrowthPolicy, TAllocator>::Vector(std::initializer_list<T> list, const TAllocator& allocator) :
+		allocator(allocator)
 	{
 		Reserve(list.size());
 		for (auto& data : list)
@@ -195,29 +194,27 @@ namespace FieaGameEngine
 		}
 	}
 
-	template<typename T>
-	inline Vector<T>::Vector(Vector&& other) noexcept :
-		arrayPtr(other.arrayPtr), size(other.size), capacity(other.capacity)
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	inline Vector<T, TGrowthPolicy, TAllocator>::Vector(Vector&& other) noexcept :
+		arrayPtr(other.arrayPtr), size(other.size), capacity(other.capacity), allocator(std::move(other.allocator))
 	{
 		other.arrayPtr = nullptr;
 		other.size = 0;
 		other.capacity = 0;
 	}
 
-	template<typename T>
-	inline Vector<T>::~Vector()
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	inline Vector<T, TGrowthPolicy, TAllocator>::~Vector()
 	{
-		Clear();
-		free(arrayPtr);
+		Release();
 	}
 
-	template<typename T>
-	Vector<T>& Vector<T>::operator=(const Vector& other)
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	Vector<T, TGrowthPolicy, TAllocator>& Vector<T, TGrowthPolicy, TAllocator>::operator=(const Vector& other)
 	{
 		if (this != &other)
 		{
 			Clear();
-			free(arrayPtr);
 			Reserve(other.size);
 			for (auto it = other.cbegin(); it != other.cend(); ++it)
 			{
@@ -227,29 +224,28 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template<typename T>
-	Vector<T>& Vector<T>::operator=(const std::initializer_list<T> list)
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	Vector<T, TGrowthPolicy, TAllocator>& Vector<T, TGrowthPolicy, TAllocator>::operator=(const std::initializer_list<T> list)
 	{
 		Clear();
-		free(arrayPtr);
 		Reserve(list.size());
-		for (auto data : list)
+		for (auto& data : list)
 		{
 			PushBack(data);
 		}
 		return *this;
 	}
 
-	template<typename T>
-	Vector<T>& Vector<T>::operator=(Vector&& other) noexcept
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	Vector<T, TGrowthPolicy, TAllocator>& Vector<T, TGrowthPolicy, TAllocator>::operator=(Vector&& other) noexcept
 	{
 		if (this != &other)
 		{
-			Clear();
-			free(arrayPtr);
+			Release();
 			arrayPtr = other.arrayPtr;
 			size = other.size;
 			capacity = other.capacity;
+			allocator = std::move(other.allocator);
 			other.arrayPtr = nullptr;
 			other.size = 0;
 			other.capacity = 0;
@@ -257,8 +253,8 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template<typename T>
-	bool Vector<T>::operator==(const Vector& rhs) const
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	bool Vector<T, TGrowthPolicy, TAllocator>::operator==(const Vector& rhs) const
 	{
 		bool result = false;
 		if (size == rhs.size)
@@ -275,14 +271,14 @@ namespace FieaGameEngine
 		return result;
 	}
 
-	template<typename T>
-	bool Vector<T>::operator!=(const Vector& rhs) const
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	bool Vector<T, TGrowthPolicy, TAllocator>::operator!=(const Vector& rhs) const
 	{
 		return !operator==(rhs);
 	}
 
-	template<typename T>
-	T& Vector<T>::operator[](std::size_t index)
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	T& Vector<T, TGrowthPolicy, TAllocator>::operator[](std::size_t index)
 	{
 		if (index >= size)
 		{
@@ -291,8 +287,8 @@ namespace FieaGameEngine
 		return arrayPtr[index];
 	}
 
-	template<typename T>
-	const T& Vector<T>::operator[](std::size_t index) const
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	const T& Vector<T, TGrowthPolicy, TAllocator>::operator[](std::size_t index) const
 	{
 		if (index >= size)
 		{
@@ -301,8 +297,8 @@ namespace FieaGameEngine
 		return arrayPtr[index];
 	}
 
-	template<typename T>
-	typename Vector<T>::Iterator Vector<T>::At(std::size_t index)
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	typename Vector<T, TGrowthPolicy, TAllocator>::Iterator Vector<T, TGrowthPolicy, TAllocator>::At(std::size_t index)
 	{
 		if (index >= size)
 		{
@@ -311,8 +307,8 @@ namespace FieaGameEngine
 		return Iterator(*this, index);
 	}
 
-	template<typename T>
-	typename Vector<T>::ConstIterator Vector<T>::At(std::size_t index) const
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	typename Vector<T, TGrowthPolicy, TAllocator>::ConstIterator Vector<T, TGrowthPolicy, TAllocator>::At(std::size_t index) const
 	{
 		if (index >= size)
 		{
@@ -321,8 +317,8 @@ namespace FieaGameEngine
 		return ConstIterator(*this, index);
 	}
 
-	template<typename T>
-	void Vector<T>::PopBack()
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	void Vector<T, TGrowthPolicy, TAllocator>::PopBack()
 	{
 		if (size == 0)
 		{
@@ -333,14 +329,14 @@ namespace FieaGameEngine
 		--size;
 	}
 
-	template<typename T>
-	inline bool Vector<T>::IsEmpty() const
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	inline bool Vector<T, TGrowthPolicy, TAllocator>::IsEmpty() const
 	{
 		return size == 0;
 	}
 
-	template<typename T>
-	T& Vector<T>::Front()
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	T& Vector<T, TGrowthPolicy, TAllocator>::Front()
 	{
 		if (size == 0)
 		{
@@ -349,8 +345,8 @@ namespace FieaGameEngine
 		return arrayPtr[0];
 	}
 
-	template<typename T>
-	const T& Vector<T>::Front() const
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	const T& Vector<T, TGrowthPolicy, TAllocator>::Front() const
 	{
 		if (size == 0)
 		{
@@ -359,8 +355,8 @@ namespace FieaGameEngine
 		return arrayPtr[0];
 	}
 
-	template<typename T>
-	T& Vector<T>::Back()
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	T& Vector<T, TGrowthPolicy, TAllocator>::Back()
 	{
 		if (size == 0)
 		{
@@ -369,8 +365,8 @@ namespace FieaGameEngine
 		return arrayPtr[size - 1];
 	}
 
-	template<typename T>
-	const T& Vector<T>::Back() const
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	const T& Vector<T, TGrowthPolicy, TAllocator>::Back() const
 	{
 		if (size == 0)
 		{
@@ -379,93 +375,119 @@ namespace FieaGameEngine
 		return arrayPtr[size - 1];
 	}
 
-	template<typename T>
-	inline size_t Vector<T>::Size() const
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	inline size_t Vector<T, TGrowthPolicy, TAllocator>::Size() const
 	{
 		return size;
 	}
 
-	template<typename T>
-	inline size_t Vector<T>::Capacity() const
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	inline size_t Vector<T, TGrowthPolicy, TAllocator>::Capacity() const
 	{
 		return capacity;
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::cbegin() const
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	inline typename Vector<T, TGrowthPolicy, TAllocator>::ConstIterator Vector<T, TGrowthPolicy, TAllocator>::cbegin() const
 	{
 		return ConstIterator(*this, 0);
 	}
 
-	template<typename T>
-	inline typename Vector<T>::Iterator Vector<T>::begin()
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	inline typename Vector<T, TGrowthPolicy, TAllocator>::Iterator Vector<T, TGrowthPolicy, TAllocator>::begin()
 	{
 		return Iterator(*this, 0);
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::begin() const
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	inline typename Vector<T, TGrowthPolicy, TAllocator>::ConstIterator Vector<T, TGrowthPolicy, TAllocator>::begin() const
 	{
 		return cbegin();
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::cend() const
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	inline typename Vector<T, TGrowthPolicy, TAllocator>::ConstIterator Vector<T, TGrowthPolicy, TAllocator>::cend() const
 	{
 		return ConstIterator(*this, size);
 	}
 
-	template<typename T>
-	inline typename Vector<T>::Iterator Vector<T>::end()
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	inline typename Vector<T, TGrowthPolicy, TAllocator>::Iterator Vector<T, TGrowthPolicy, TAllocator>::end()
 	{
 		return Iterator(*this, size);
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::end() const
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	inline typename Vector<T, TGrowthPolicy, TAllocator>::ConstIterator Vector<T, TGrowthPolicy, TAllocator>::end() const
 	{
 		return cend();
 	}
 
-	template<typename T>
-	void Vector<T>::PushBack(const T& data)
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	inline void Vector<T, TGrowthPolicy, TAllocator>::PushBack(const T& data)
 	{
-		if (size == capacity)
-		{
-			Reserve(reserveFunctor(size, capacity));
-		}
+		EmplaceBack(data);
+	}
 
-		new (arrayPtr + size) T(data);
-		++size;
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	inline void Vector<T, TGrowthPolicy, TAllocator>::PushBack(T&& data)
+	{
+		EmplaceBack(std::move(data));
 	}
 
-	template<typename T>
-	void Vector<T>::PushBack(T&& data)
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	template<typename... Args>
+	T& Vector<T, TGrowthPolicy, TAllocator>::EmplaceBack(Args&&... args)
 	{
-		if (size == capacity)
+		if (size < capacity)
 		{
-			Reserve(reserveFunctor(size, capacity));
+			new (arrayPtr + size) T(std::forward<Args>(args)...);
 		}
-
-		new (arrayPtr + size) T(data);
-		++size;
+		else if constexpr (Relocatable)
+		{
+			// The arguments may live in the current block, so build the item before the block moves.
+			T item(std::forward<Args>(args)...);
+			Reallocate(NextCapacity());
+			new (arrayPtr + size) T(std::move(item));
+		}
+		else
+		{
+			// Construct into the new block first so arguments referring to current items stay valid.
+			std::size_t newCapacity = NextCapacity();
+			T* newArray = static_cast<T*>(allocator.Allocate(sizeof(T) * newCapacity));
+			try
+			{
+				new (newArray + size) T(std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				allocator.Deallocate(newArray);
+				throw;
+			}
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				new (newArray + i) T(std::move_if_noexcept(arrayPtr[i]));
+				arrayPtr[i].~T();
+			}
+			allocator.Deallocate(arrayPtr);
+			arrayPtr = newArray;
+			capacity = newCapacity;
+		}
+		return arrayPtr[size++];
 	}
 
-	template<typename T>
-	void Vector<T>::Reserve(std::size_t newCapacity)
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	void Vector<T, TGrowthPolicy, TAllocator>::Reserve(std::size_t newCapacity)
 	{
 		if (newCapacity > capacity)
 		{
-			T* temp = static_cast<T*>(realloc(arrayPtr, sizeof(T) * newCapacity));
-			assert(temp != nullptr);
-			arrayPtr = temp;
-			capacity = newCapacity;
+			Reallocate(newCapacity);
 		}		
 	}
 
-	template<typename T>
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
 	template<typename EqualityFunctor>
-	typename Vector<T>::Iterator Vector<T>::Find(const T& value)
+	typename Vector<T, TGrowthPolicy, TAllocator>::Iterator Vector<T, TGrowthPolicy, TAllocator>::Find(const T& value)
 	{
 		EqualityFunctor equalityFunc;
 		Iterator it;
@@ -479,9 +501,9 @@ namespace FieaGameEngine
 		return it;
 	}
 
-	template<typename T>
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
 	template<typename EqualityFunctor>
-	typename Vector<T>::ConstIterator Vector<T>::Find(const T& value) const
+	typename Vector<T, TGrowthPolicy, TAllocator>::ConstIterator Vector<T, TGrowthPolicy, TAllocator>::Find(const T& value) const
 	{
 		EqualityFunctor equalityFunc;
 		ConstIterator it;
@@ -495,21 +517,21 @@ namespace FieaGameEngine
 		return it;
 	}
 
-	template <typename T>
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
 	template <typename EqualityFunctor>
-	bool Vector<T>::Contains(const T& value) const
+	bool Vector<T, TGrowthPolicy, TAllocator>::Contains(const T& value) const
 	{
 		return Find(value) != cend();
 	}
 
-	template<typename T>
-	bool Vector<T>::Remove(const T& value)
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	bool Vector<T, TGrowthPolicy, TAllocator>::Remove(const T& value)
 	{
 		return Remove(Find(value));
 	}
 
-	template<typename T>
-	bool Vector<T>::Remove(const Iterator& it)
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	bool Vector<T, TGrowthPolicy, TAllocator>::Remove(const Iterator& it)
 	{
 		if (it.owner != this)
 		{
@@ -520,17 +542,14 @@ namespace FieaGameEngine
 
 		if (it != end())
 		{
-			arrayPtr[it.index].~T();
-			memmove_s(arrayPtr + it.index, (capacity - it.index) * sizeof(T), 
-				arrayPtr + (it.index + 1), (capacity - it.index - 1) * sizeof(T));
-			--size;
+			Remove(it, Iterator(*this, it.index + 1));
 			successful = true;
 		}
 		return successful;
 	}
 
-	template<typename T>
-	bool Vector<T>::Remove(const Iterator& startIt, const Iterator& endIt)
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	bool Vector<T, TGrowthPolicy, TAllocator>::Remove(const Iterator& startIt, const Iterator& endIt)
 	{
 		if (startIt.owner != this)
 		{
@@ -547,45 +566,54 @@ namespace FieaGameEngine
 
 		if (startIt.index != endIt.index)
 		{
-			for (std::size_t i = startIt.index; i < endIt.index; ++i)
+			const std::size_t count = endIt.index - startIt.index;
+			if constexpr (Relocatable)
 			{
-				arrayPtr[i].~T();
-				--size;
+				for (std::size_t i = startIt.index; i < endIt.index; ++i)
+				{
+					arrayPtr[i].~T();
+				}
+				std::memmove(static_cast<void*>(arrayPtr + startIt.index), arrayPtr + endIt.index, (size - endIt.index) * sizeof(T));
 			}
-			memmove_s(arrayPtr + startIt.index, (capacity - startIt.index) * sizeof(T),
-				arrayPtr + endIt.index, (capacity - endIt.index) * sizeof(T));
+			else
+			{
+				for (std::size_t i = endIt.index; i < size; ++i)
+				{
+					arrayPtr[i - count] = std::move(arrayPtr[i]);
+				}
+				for (std::size_t i = size - count; i < size; ++i)
+				{
+					arrayPtr[i].~T();
+				}
+			}
+			size -= count;
 
 			return true;
 		}
 		return false;
 	}
 
-	template<typename T>
-	void Vector<T>::ShrinkToFit()
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	void Vector<T, TGrowthPolicy, TAllocator>::ShrinkToFit()
 	{
 		if (size == 0)
 		{
-			free(arrayPtr);
-			arrayPtr = nullptr;
-			capacity = 0;
+			Release();
 		}
 		else if (size != capacity)
 		{
-			T* data = reinterpret_cast<T*>(realloc(arrayPtr, size * sizeof(T)));
-			assert(data != nullptr);
-			arrayPtr = data;
-			capacity = size;
+			Reallocate(size);
 		}
 	}
 
-	template<typename T>
-	void Vector<T>::Resize(std::size_t newSize)
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	void Vector<T, TGrowthPolicy, TAllocator>::Resize(std::size_t newSize)
 	{
 		if (newSize > size)
 		{
 			Reserve(newSize);
 
-			for (std::size_t i = size; i < capacity; ++i)
+			for (std::size_t i = size; i < newSize; ++i)
 			{
 				new (arrayPtr + i) T();
 			}
@@ -597,24 +625,13 @@ namespace FieaGameEngine
 			{
 				arrayPtr[i].~T();
 			}
-			if (newSize == 0)
-			{
-				free(arrayPtr);
-				arrayPtr = nullptr;
-			}
-			else
-			{
-				T* temp = static_cast<T*>(realloc(arrayPtr, sizeof(T) * newSize));
-				assert(temp != nullptr);
-				arrayPtr = temp;
-			}			
-			capacity = newSize;
 			size = newSize;
+			ShrinkToFit();
 		}
 	}
 
-	template<typename T>
-	void Vector<T>::Clear()
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	void Vector<T, TGrowthPolicy, TAllocator>::Clear()
 	{
 		for (std::size_t i = 0; i < size; ++i)
 		{
@@ -623,10 +640,53 @@ namespace FieaGameEngine
 		size = 0;
 	}
 
-	template<typename T>
-	std::size_t Vector<T>::IndexOf(const T& value) const
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	std::size_t Vector<T, TGrowthPolicy, TAllocator>::IndexOf(const T& value) const
 	{
 		ConstIterator it = Find(value);
 		return it.index;
 	}
+
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	inline const TAllocator& Vector<T, TGrowthPolicy, TAllocator>::GetAllocator() const
+	{
+		return allocator;
+	}
+
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	void Vector<T, TGrowthPolicy, TAllocator>::Reallocate(std::size_t newCapacity)
+	{
+		assert(newCapacity >= size);
+		if constexpr (Relocatable)
+		{
+			arrayPtr = static_cast<T*>(allocator.Reallocate(arrayPtr, sizeof(T) * newCapacity));
+		}
+		else
+		{
+			T* newArray = static_cast<T*>(allocator.Allocate(sizeof(T) * newCapacity));
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				new (newArray + i) T(std::move_if_noexcept(arrayPtr[i]));
+				arrayPtr[i].~T();
+			}
+			allocator.Deallocate(arrayPtr);
+			arrayPtr = newArray;
+		}
+		capacity = newCapacity;
+	}
+
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	void Vector<T, TGrowthPolicy, TAllocator>::Release()
+	{
+		Clear();
+		allocator.Deallocate(arrayPtr);
+		arrayPtr = nullptr;
+		capacity = 0;
+	}
+
+	template<typename T, typename TGrowthPolicy, typename TAllocator>
+	inline std::size_t Vector<T, TGrowthPolicy, TAllocator>::NextCapacity() const
+	{
+		return std::max(TGrowthPolicy{}(size, capacity), size + 1);
+	}
 }
\ No newline at end of file